@@ -0,0 +1,34 @@
+
+
+#include "AdaptiveFactoring.h"
+#include "FactorKernels.h"
+#include "FactorizationBatch.h"
+
+// AdaptiveFactoring Class: Chooses a factoring engine per number
+// Adheres to OCP: New engines can be slotted in by size range without changing callers,
+// which only see a FactoringMethod.
+
+AdaptiveFactoring::AdaptiveFactoring(std::uint32_t sieveLimit, std::uint64_t trialDivisionLimit)
+    : sieve(sieveLimit), trialDivisionLimit(trialDivisionLimit) {}
+
+std::vector<std::uint64_t> AdaptiveFactoring::factorize(std::uint64_t number) const {
+    std::vector<std::uint64_t> factors;
+    appendFactors(number, factors);
+    return factors;
+}
+
+void AdaptiveFactoring::factorizeBatch(std::span<const std::uint64_t> numbers, FactorizationBatch& out, ThreadPool* pool) const {
+    factorizeInParallel(numbers, out, pool, [this](std::uint64_t number, std::vector<std::uint64_t>& factors) {
+        appendFactors(number, factors);
+    });
+}
+
+void AdaptiveFactoring::appendFactors(std::uint64_t number, std::vector<std::uint64_t>& factors) const {
+    if (number <= sieve.getLimit()) {
+        sieve.appendFactors(static_cast<std::uint32_t>(number), factors);
+    } else if (number < trialDivisionLimit) {
+        trialDivisionFactors(number, factors);
+    } else {
+        pollardRhoFactors(number, factors);
+    }
+}
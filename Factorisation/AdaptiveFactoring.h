@@ -0,0 +1,29 @@
+
+
+#ifndef ADAPTIVE_FACTORING_H
+#define ADAPTIVE_FACTORING_H
+
+#include <cstdint>
+#include "FactoringMethod.h"
+#include "SieveFactoring.h"
+
+// Picks the fastest engine for each number by its size: a smallest-prime-factor table up to
+// sieveLimit, trial division below trialDivisionLimit, and Pollard's rho above that.
+// The defaults follow the crossover points measured by bench/FactorizationBenchmark.
+class AdaptiveFactoring : public FactoringMethod {
+public:
+    explicit AdaptiveFactoring(std::uint32_t sieveLimit = 1u << 20, std::uint64_t trialDivisionLimit = 1u << 21);
+
+    using FactoringMethod::factorize;
+    std::vector<std::uint64_t> factorize(std::uint64_t number) const override;
+    void factorizeBatch(std::span<const std::uint64_t> numbers, FactorizationBatch& out, ThreadPool* pool = nullptr) const override;
+
+    // Append the factors of number to factors (non-virtual; used by the batch API)
+    void appendFactors(std::uint64_t number, std::vector<std::uint64_t>& factors) const;
+
+private:
+    SieveFactoring sieve;
+    std::uint64_t trialDivisionLimit;
+};
+
+#endif // ADAPTIVE_FACTORING_H
@@ -0,0 +1,56 @@
+
+
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Owning storage for entities of one type that are created in bulk and freed together.
+// Objects are constructed back to back in large chunks, never move, and carry no per-object
+// bookkeeping; the arena destroys them all (skipping destructors that do nothing) and
+// releases the chunks when it is destroyed. Not thread-safe.
+template <typename T, std::size_t ChunkSize = 4096>
+class Arena {
+public:
+    Arena() = default;
+    ~Arena() {
+        for (std::size_t chunk = chunks.size(); chunk-- > 0;) {
+            std::size_t used = chunk + 1 == chunks.size() ? lastChunkUsed : ChunkSize;
+            if constexpr (!std::is_trivially_destructible_v<T>) {
+                std::destroy_n(chunks[chunk], used);
+            }
+            std::allocator<T>().deallocate(chunks[chunk], ChunkSize);
+        }
+    }
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    // Construct an object in the arena; it lives as long as the arena
+    template <typename... Args>
+    T* create(Args&&... args) {
+        if (chunks.empty() || lastChunkUsed == ChunkSize) {
+            chunks.reserve(chunks.size() + 1);
+            chunks.push_back(std::allocator<T>().allocate(ChunkSize));
+            lastChunkUsed = 0;
+        }
+        T* object = std::construct_at(chunks.back() + lastChunkUsed, std::forward<Args>(args)...);
+        ++lastChunkUsed;
+        return object;
+    }
+
+    // Number of objects created
+    std::size_t size() const {
+        return chunks.empty() ? 0 : (chunks.size() - 1) * ChunkSize + lastChunkUsed;
+    }
+
+private:
+    std::vector<T*> chunks;
+    std::size_t lastChunkUsed = 0; // Objects constructed in the last chunk
+};
+
+#endif // ARENA_H
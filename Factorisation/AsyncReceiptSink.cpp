@@ -0,0 +1,105 @@
+
+
+#include "AsyncReceiptSink.h"
+#include <stdexcept>
+
+// AsyncReceiptSink Class: Moves receipt I/O off the checkout path
+// Adheres to SRP: Only concerned with buffering and handing text to another sink; where the
+// text ends up is the wrapped sink's business.
+
+AsyncReceiptSink::AsyncReceiptSink(ReceiptSink& target, std::size_t capacity)
+    : target(target), ring(capacity) {
+    if (capacity == 0) {
+        throw std::invalid_argument("Receipt ring capacity must be greater than zero.");
+    }
+    writer = std::thread(&AsyncReceiptSink::run, this);
+}
+
+AsyncReceiptSink::~AsyncReceiptSink() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    notEmpty.notify_one();
+    writer.join();
+    try {
+        if (!failure) {
+            target.flush();
+        }
+    } catch (...) {
+        // Destructors must not throw; call flush() first to see the error
+    }
+}
+
+// Queue text for the writer thread
+void AsyncReceiptSink::write(std::string_view text) {
+    bool wasEmpty;
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        notFull.wait(lock, [this] { return count < ring.size() || failure; });
+        if (failure) {
+            std::rethrow_exception(failure);
+        }
+        ring[(head + count) % ring.size()].assign(text);
+        wasEmpty = count++ == 0;
+    }
+    if (wasEmpty) {
+        notEmpty.notify_one(); // Otherwise the writer thread is awake and will see this slot
+    }
+}
+
+// Wait for the ring to drain, then flush the target
+void AsyncReceiptSink::flush() {
+    std::unique_lock<std::mutex> lock(mutex);
+    drained.wait(lock, [this] { return (count == 0 && !draining) || failure; });
+    if (failure) {
+        std::rethrow_exception(failure);
+    }
+    target.flush(); // The writer cannot start another batch while we hold the lock
+}
+
+// Writer thread: take everything queued in one go and pass it on outside the lock, as one
+// write to the target
+void AsyncReceiptSink::run() {
+    std::vector<std::string> batch(ring.size());
+    std::string block; // Reused, so steady-state batches do not allocate
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        notEmpty.wait(lock, [this] { return count > 0 || stopping; });
+        if (count == 0) {
+            return; // Stopping and fully drained
+        }
+
+        std::size_t taken = count;
+        for (std::size_t i = 0; i < taken; ++i) {
+            ring[(head + i) % ring.size()].swap(batch[i]); // Swapping keeps both buffers allocated
+        }
+        head = (head + taken) % ring.size();
+        count = 0;
+        draining = true;
+        notFull.notify_all();
+
+        lock.unlock();
+        block.clear();
+        for (std::size_t i = 0; i < taken; ++i) {
+            block += batch[i];
+        }
+        try {
+            target.write(block);
+        } catch (...) {
+            lock.lock();
+            failure = std::current_exception();
+            count = 0; // Drop what is queued; writers and flush() see the failure instead
+            draining = false;
+            notFull.notify_all();
+            drained.notify_all();
+            return;
+        }
+        lock.lock();
+
+        draining = false;
+        if (count == 0) {
+            drained.notify_all();
+        }
+    }
+}
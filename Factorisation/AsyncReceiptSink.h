@@ -0,0 +1,54 @@
+
+
+#ifndef ASYNC_RECEIPT_SINK_H
+#define ASYNC_RECEIPT_SINK_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include "ReceiptSink.h"
+
+// Hands receipts to a background writer thread through a bounded ring buffer, so callers
+// only pay for a copy into a reused slot. Writers block only while the ring is full.
+// Safe to write to from several threads.
+// If the target throws, the writer thread stops and drops what is still queued; write() and
+// flush() then rethrow that exception.
+class AsyncReceiptSink : public ReceiptSink {
+public:
+    explicit AsyncReceiptSink(ReceiptSink& target, std::size_t capacity = 1024);
+    ~AsyncReceiptSink() override; // Drains the ring and stops the writer thread
+
+    AsyncReceiptSink(const AsyncReceiptSink&) = delete;
+    AsyncReceiptSink& operator=(const AsyncReceiptSink&) = delete;
+
+    // Queue text (rethrows a failure of the target)
+    void write(std::string_view text) override;
+
+    // Wait until everything written so far has reached the target, then flush the target
+    // (rethrows a failure of the target)
+    void flush() override;
+
+private:
+    ReceiptSink& target;
+    std::vector<std::string> ring; // Slots keep their capacity, so steady-state writes do not allocate
+    std::size_t head = 0;          // Next slot to drain
+    std::size_t count = 0;         // Occupied slots
+    bool draining = false;         // Writer thread is handing a batch to the target
+    bool stopping = false;
+    std::exception_ptr failure;    // First exception thrown by the target
+
+    std::mutex mutex;
+    std::condition_variable notEmpty;
+    std::condition_variable notFull;
+    std::condition_variable drained;
+    std::thread writer;
+
+    void run();
+};
+
+#endif // ASYNC_RECEIPT_SINK_H
@@ -4,8 +4,8 @@
 // to be added without altering the rest of the system.
 #include "Category.h"
 
-Category::Category(int id, const std::string& name) : category_id(id), category_name(name) {}
+Category::Category(int id, std::string_view name) : category_id(id), category_name(name) {}
 
 int Category::getCategoryId() const { return category_id; }
 
-std::string Category::getName() const { return category_name; }
+std::string_view Category::getName() const { return category_name; }
@@ -4,6 +4,7 @@
 #define CATEGORY_H
 
 #include <string>
+#include <string_view>
 
 class Category {
 private:
@@ -11,9 +12,9 @@ private:
     std::string category_name;
 
 public:
-    Category(int id, const std::string& name);
+    Category(int id, std::string_view name);
     int getCategoryId() const;
-    std::string getName() const;
+    std::string_view getName() const; // Valid for the category's lifetime
 };
 
 #endif // CATEGORY_H
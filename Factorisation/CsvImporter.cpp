@@ -0,0 +1,317 @@
+
+
+#include "CsvImporter.h"
+#include "MappedFile.h"
+#include <algorithm> // For std::count, std::min
+#include <charconv>
+#include <cstring>
+#include <future>
+#include <iterator> // For std::back_inserter
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// CsvImporter Class: Loads bulk data files into the managers
+// Adheres to SRP: Only turns CSV records into manager calls; storage and validation of the
+// entities stay with ProductManager and CustomerManager.
+
+namespace {
+
+// A malformed line, numbered from the start of its chunk
+struct ChunkError {
+    std::size_t line;
+    std::string message;
+};
+
+// Splits one line into fields without copying
+class FieldReader {
+public:
+    explicit FieldReader(std::string_view line) : rest(line) {}
+
+    bool atEnd() const {
+        return finished;
+    }
+
+    // The next field; throws if the line has no more fields
+    std::string_view next(const char* name) {
+        if (finished) {
+            throw std::invalid_argument(std::string("missing field ") + name);
+        }
+        std::string_view field;
+        if (!rest.empty() && rest.front() == '"') {
+            std::size_t close = rest.find('"', 1);
+            if (close == std::string_view::npos) {
+                throw std::invalid_argument(std::string("unterminated quote in ") + name);
+            }
+            field = rest.substr(1, close - 1);
+            rest.remove_prefix(close + 1);
+            if (!rest.empty() && rest.front() != ',') {
+                throw std::invalid_argument(std::string("unexpected text after quoted ") + name);
+            }
+        } else {
+            field = rest.substr(0, rest.find(','));
+            rest.remove_prefix(field.size());
+        }
+        if (rest.empty()) {
+            finished = true;
+        } else {
+            rest.remove_prefix(1); // The comma
+        }
+        return field;
+    }
+
+    // Fail if fields remain
+    void expectEnd() const {
+        if (!finished) {
+            throw std::invalid_argument("too many fields");
+        }
+    }
+
+private:
+    std::string_view rest;
+    bool finished = false;
+};
+
+template <typename Number>
+Number parseNumber(std::string_view field, const char* name) {
+    Number value{};
+    auto [end, error] = std::from_chars(field.data(), field.data() + field.size(), value);
+    if (error != std::errc() || end != field.data() + field.size() || field.empty()) {
+        throw std::invalid_argument(std::string("invalid ") + name + " '" + std::string(field) + "'");
+    }
+    return value;
+}
+
+struct CategoryRow {
+    int category_id;
+    std::string_view name;
+};
+
+struct ProductRow {
+    int product_id;
+    std::string_view name;
+    double price;
+    int quantity;
+    int category_id;
+    bool hasCategory;
+};
+
+struct CustomerRow {
+    int customer_id;
+    std::string_view name;
+    std::string_view email;
+};
+
+struct DiscountRow {
+    int product_id;
+    Discount discount;
+};
+
+// Parse every record of a file into rows, in file order. Rows may refer into the mapping.
+template <typename Row, typename ParseLine>
+std::vector<Row> parseFile(const std::string& path, const MappedFile& file, ThreadPool* pool,
+                           std::size_t chunkBytes, ParseLine parseLine) {
+    const char* begin = file.data();
+    const char* end = begin + file.size();
+    if (begin == end) {
+        return {};
+    }
+
+    // A first line that does not start with a number is a header
+    std::size_t headerLines = 0;
+    if (!(*begin == '-' || (*begin >= '0' && *begin <= '9'))) {
+        const char* newline = static_cast<const char*>(std::memchr(begin, '\n', file.size()));
+        begin = newline == nullptr ? end : newline + 1;
+        headerLines = 1;
+    }
+
+    // Chunks end just after a newline so no record is split
+    std::vector<std::pair<const char*, const char*>> chunks;
+    for (const char* chunkBegin = begin; chunkBegin < end;) {
+        const char* cut = chunkBegin + std::min(chunkBytes, static_cast<std::size_t>(end - chunkBegin));
+        if (cut < end) {
+            const char* newline = static_cast<const char*>(std::memchr(cut, '\n', static_cast<std::size_t>(end - cut)));
+            cut = newline == nullptr ? end : newline + 1;
+        }
+        chunks.emplace_back(chunkBegin, cut);
+        chunkBegin = cut;
+    }
+
+    auto parseChunk = [&parseLine](const char* chunkBegin, const char* chunkEnd) {
+        std::vector<Row> rows;
+        std::size_t line = 0;
+        for (const char* lineBegin = chunkBegin; lineBegin < chunkEnd;) {
+            const char* newline = static_cast<const char*>(std::memchr(lineBegin, '\n', static_cast<std::size_t>(chunkEnd - lineBegin)));
+            const char* lineEnd = newline == nullptr ? chunkEnd : newline;
+            std::string_view text(lineBegin, static_cast<std::size_t>(lineEnd - lineBegin));
+            if (!text.empty() && text.back() == '\r') {
+                text.remove_suffix(1);
+            }
+            ++line;
+            if (!text.empty()) {
+                try {
+                    FieldReader fields(text);
+                    rows.push_back(parseLine(fields));
+                    fields.expectEnd();
+                } catch (const std::invalid_argument& error) {
+                    throw ChunkError{line, error.what()};
+                }
+            }
+            lineBegin = lineEnd + 1;
+        }
+        return rows;
+    };
+
+    std::vector<std::vector<Row>> parsed(chunks.size());
+    std::size_t failedChunk = chunks.size();
+    ChunkError failure{0, std::string()};
+    if (pool == nullptr || chunks.size() == 1) {
+        for (std::size_t i = 0; i < chunks.size() && failedChunk == chunks.size(); ++i) {
+            try {
+                parsed[i] = parseChunk(chunks[i].first, chunks[i].second);
+            } catch (const ChunkError& error) {
+                failedChunk = i;
+                failure = error;
+            }
+        }
+    } else {
+        std::vector<std::future<std::vector<Row>>> pending;
+        pending.reserve(chunks.size());
+        for (const auto& chunk : chunks) {
+            pending.push_back(pool->submit([&parseChunk, chunk] { return parseChunk(chunk.first, chunk.second); }));
+        }
+        for (auto& result : pending) {
+            result.wait(); // Let every chunk finish before the mapping can go away
+        }
+        for (std::size_t i = 0; i < chunks.size(); ++i) {
+            try {
+                parsed[i] = pending[i].get();
+            } catch (const ChunkError& error) {
+                if (failedChunk == chunks.size()) {
+                    failedChunk = i;
+                    failure = error;
+                }
+            }
+        }
+    }
+
+    if (failedChunk != chunks.size()) {
+        std::size_t line = headerLines + static_cast<std::size_t>(std::count(begin, chunks[failedChunk].first, '\n')) + failure.line;
+        throw std::runtime_error(path + ":" + std::to_string(line) + ": " + failure.message);
+    }
+
+    std::size_t total = 0;
+    for (const auto& rows : parsed) {
+        total += rows.size();
+    }
+    std::vector<Row> all;
+    all.reserve(total);
+    for (auto& rows : parsed) {
+        std::move(rows.begin(), rows.end(), std::back_inserter(all));
+    }
+    return all;
+}
+
+} // namespace
+
+CsvImporter::CsvImporter(ProductManager& productManager, CustomerManager& customerManager,
+                         ThreadPool* pool, std::size_t chunkBytes)
+    : productManager(productManager), customerManager(customerManager), pool(pool),
+      chunkBytes(chunkBytes == 0 ? 1 : chunkBytes) {}
+
+// Import categories
+std::size_t CsvImporter::importCategories(const std::string& path) {
+    MappedFile file(path, MappedFile::Mode::ReadOnly);
+    std::vector<CategoryRow> rows = parseFile<CategoryRow>(path, file, pool, chunkBytes, [](FieldReader& fields) {
+        CategoryRow row;
+        row.category_id = parseNumber<int>(fields.next("category_id"), "category_id");
+        row.name = fields.next("name");
+        return row;
+    });
+    for (const CategoryRow& row : rows) {
+        productManager.createCategory(row.category_id, row.name);
+    }
+    return rows.size();
+}
+
+// Import products
+std::size_t CsvImporter::importProducts(const std::string& path) {
+    MappedFile file(path, MappedFile::Mode::ReadOnly);
+    std::vector<ProductRow> rows = parseFile<ProductRow>(path, file, pool, chunkBytes, [](FieldReader& fields) {
+        ProductRow row;
+        row.product_id = parseNumber<int>(fields.next("product_id"), "product_id");
+        row.name = fields.next("name");
+        row.price = parseNumber<double>(fields.next("price"), "price");
+        row.quantity = parseNumber<int>(fields.next("quantity"), "quantity");
+        std::string_view category = fields.next("category_id");
+        row.hasCategory = !category.empty();
+        row.category_id = row.hasCategory ? parseNumber<int>(category, "category_id") : 0;
+        return row;
+    });
+
+    productManager.reserve(rows.size());
+    for (const ProductRow& row : rows) {
+        Category* category = nullptr;
+        if (row.hasCategory) {
+            category = productManager.findCategory(row.category_id);
+            if (category == nullptr) {
+                throw std::runtime_error(path + ": product " + std::to_string(row.product_id) +
+                                         " refers to unknown category " + std::to_string(row.category_id));
+            }
+        }
+        productManager.emplaceProduct(row.product_id, row.name, row.price, row.quantity, category);
+    }
+    return rows.size();
+}
+
+// Import customers
+std::size_t CsvImporter::importCustomers(const std::string& path) {
+    MappedFile file(path, MappedFile::Mode::ReadOnly);
+    std::vector<CustomerRow> rows = parseFile<CustomerRow>(path, file, pool, chunkBytes, [](FieldReader& fields) {
+        CustomerRow row;
+        row.customer_id = parseNumber<int>(fields.next("customer_id"), "customer_id");
+        row.name = fields.next("name");
+        row.email = fields.next("email");
+        return row;
+    });
+
+    for (const CustomerRow& row : rows) {
+        customerManager.emplaceCustomer(row.customer_id, row.name, row.email);
+    }
+    return rows.size();
+}
+
+// Import discounts
+std::size_t CsvImporter::importDiscounts(const std::string& path) {
+    MappedFile file(path, MappedFile::Mode::ReadOnly);
+    std::vector<DiscountRow> rows = parseFile<DiscountRow>(path, file, pool, chunkBytes, [](FieldReader& fields) {
+        int product_id = parseNumber<int>(fields.next("product_id"), "product_id");
+        Discount discount;
+        std::size_t rules = 0;
+        do {
+            std::string_view name = fields.next("rule");
+            Discount::Rule rule = Discount::parseRule(name);
+            if (rule == Discount::Rule::Invalid) {
+                throw std::invalid_argument("unknown discount rule '" + std::string(name) + "'");
+            }
+            double value = parseNumber<double>(fields.next("value"), "value");
+            if (rules++ == 0) {
+                discount = Discount(rule, value);
+            } else if (rules <= Discount::kMaxSteps) {
+                discount.then(rule, value);
+            } else {
+                throw std::invalid_argument("too many discount rules");
+            }
+        } while (!fields.atEnd());
+        return DiscountRow{product_id, discount};
+    });
+
+    for (const DiscountRow& row : rows) {
+        if (productManager.findProduct(row.product_id) == nullptr) {
+            throw std::runtime_error(path + ": discount for unknown product " + std::to_string(row.product_id));
+        }
+        productManager.setDiscount(row.product_id, row.discount);
+    }
+    return rows.size();
+}
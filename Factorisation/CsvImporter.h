@@ -0,0 +1,47 @@
+
+
+#ifndef CSV_IMPORTER_H
+#define CSV_IMPORTER_H
+
+#include <cstddef>
+#include <string>
+#include "ProductManager.h"
+#include "CustomerManager.h"
+#include "ThreadPool.h"
+
+// Bulk import of catalog and customer data from CSV files.
+// Files are memory-mapped and split into chunks at line boundaries; chunks are parsed in
+// parallel on the thread pool (when one is given) into rows of numbers and views into the
+// mapping, and the rows are then inserted into the managers in file order.
+//
+// One record per line, fields separated by commas; a field may be enclosed in double quotes
+// to contain commas (quotes inside fields are not supported). Empty lines are skipped, and a
+// first line that does not start with a number is taken as a header and skipped.
+//   categories: category_id,name
+//   products:   product_id,name,price,quantity,category_id   (category_id may be empty)
+//   customers:  customer_id,name,email
+//   discounts:  product_id,rule,value[,rule,value]...        (rules as in Discount::parseRule)
+//
+// Malformed files throw std::runtime_error naming the file and line before anything is
+// inserted. Insertion errors (duplicate IDs, unknown products or categories) throw part way
+// through, leaving the rows before the failing one imported.
+class CsvImporter {
+public:
+    CsvImporter(ProductManager& productManager, CustomerManager& customerManager,
+                ThreadPool* pool = nullptr, std::size_t chunkBytes = 4 * 1024 * 1024);
+
+    // Each returns the number of records imported. Import categories before the products
+    // that refer to them, and products before their discounts.
+    std::size_t importCategories(const std::string& path);
+    std::size_t importProducts(const std::string& path);
+    std::size_t importCustomers(const std::string& path);
+    std::size_t importDiscounts(const std::string& path);
+
+private:
+    ProductManager& productManager;
+    CustomerManager& customerManager;
+    ThreadPool* pool;
+    std::size_t chunkBytes;
+};
+
+#endif // CSV_IMPORTER_H
@@ -6,7 +6,7 @@
 // Adheres to SRP: Handles only the properties and state of a single customer.
 
 // Constructor
-Customer::Customer(int id, const std::string& name, const std::string& email)
+Customer::Customer(int id, std::string_view name, std::string_view email)
     : customer_id(id), customer_name(name), customer_email(email) {}
 
 // Getters
@@ -14,19 +14,19 @@ int Customer::getCustomerId() const {
     return customer_id;
 }
 
-std::string Customer::getName() const {
+std::string_view Customer::getName() const {
     return customer_name;
 }
 
-std::string Customer::getEmail() const {
+std::string_view Customer::getEmail() const {
     return customer_email;
 }
 
 // Setters (if needed)
-void Customer::setName(const std::string& name) {
+void Customer::setName(std::string_view name) {
     customer_name = name;
 }
 
-void Customer::setEmail(const std::string& email) {
+void Customer::setEmail(std::string_view email) {
     customer_email = email;
 }
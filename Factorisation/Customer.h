@@ -4,25 +4,26 @@
 #define CUSTOMER_H
 
 #include <string>
+#include <string_view>
 
 class Customer {
 private:
     int customer_id;           // Unique ID for the customer
-    std::string customer_name; // Name of the customer
+    std::string customer_name;  // Name of the customer
     std::string customer_email; // Email address of the customer
 
 public:
     // Constructor
-    Customer(int id, const std::string& name, const std::string& email);
+    Customer(int id, std::string_view name, std::string_view email);
 
     // Getters
     int getCustomerId() const;
-    std::string getName() const;
-    std::string getEmail() const;
+    std::string_view getName() const;  // Valid until the customer is renamed or destroyed
+    std::string_view getEmail() const; // Valid until the email is changed or the customer destroyed
 
     // Setters (if needed in the future)
-    void setName(const std::string& name);
-    void setEmail(const std::string& email);
+    void setName(std::string_view name);
+    void setEmail(std::string_view email);
 };
 
 #endif // CUSTOMER_H
@@ -1,46 +1,145 @@
 #include "CustomerManager.h"
+#include <algorithm> // For std::partial_sort, std::min, std::max
 
 // CustomerManager Class: Handles customer operations
 // Adheres to SRP: Focuses only on managing customers and their purchase histories.
 
-// Destructor to clean up allocated memory
-CustomerManager::~CustomerManager() {
-    for (auto& pair : customers) {
-        delete pair.second;
-    }
-}
-
 // Add a new customer
 void CustomerManager::addCustomer(Customer* customer) {
     if (customers.find(customer->getCustomerId()) != customers.end()) {
         throw std::invalid_argument("Customer with this ID already exists.");
     }
-    customers[customer->getCustomerId()] = customer;
+    Customer* stored = customerStorage.create(std::move(*customer));
+    delete customer; // The manager's storage now holds the customer
+    customers[stored->getCustomerId()] = stored;
+    customerPurchases.try_emplace(stored->getCustomerId(), productSales); // History exists up front so purchases never modify the map
+}
+
+// Construct a new customer in place
+Customer* CustomerManager::emplaceCustomer(int customer_id, std::string_view name, std::string_view email) {
+    auto [it, inserted] = customers.try_emplace(customer_id, nullptr);
+    if (!inserted) {
+        throw std::invalid_argument("Customer with this ID already exists.");
+    }
+    try {
+        it->second = customerStorage.create(customer_id, name, email);
+    } catch (...) {
+        customers.erase(it);
+        throw;
+    }
+    customerPurchases.try_emplace(customer_id, productSales);
+    return it->second;
 }
 
 // Retrieve a customer by ID
 Customer* CustomerManager::getCustomer(int customer_id) const {
-    auto it = customers.find(customer_id);
-    if (it == customers.end()) {
+    Customer* customer = findCustomer(customer_id);
+    if (customer == nullptr) {
         throw std::invalid_argument("Customer not found.");
     }
-    return it->second;
+    return customer;
+}
+
+// Retrieve a customer by ID without throwing
+Customer* CustomerManager::findCustomer(int customer_id) const noexcept {
+    auto it = customers.find(customer_id);
+    return it == customers.end() ? nullptr : it->second;
 }
 
 // Add a purchase record for a customer
-void CustomerManager::addPurchase(int customer_id, const std::string& product_name, int quantity, double total_cost) {
-    if (customers.find(customer_id) == customers.end()) {
+void CustomerManager::addPurchase(int customer_id, int product_id, std::string_view product_name, int quantity, double total_cost) {
+    if (product_id < kUnlistedProductLimit) {
+        // A restored name-only purchase: keep its ID for the name and allocate past it
+        std::lock_guard<std::mutex> lock(unlistedProductsLock);
+        unlistedProducts.try_emplace(std::string(product_name), product_id);
+        nextUnlistedProduct = std::max(nextUnlistedProduct, product_id + 1);
+    }
+    recordPurchase(customer_id, product_id, product_name, quantity, total_cost);
+}
+
+// Add a purchase of a product known only by name
+void CustomerManager::addPurchase(int customer_id, std::string_view product_name, int quantity, double total_cost) {
+    int product_id;
+    {
+        std::lock_guard<std::mutex> lock(unlistedProductsLock);
+        auto it = unlistedProducts.find(product_name);
+        if (it == unlistedProducts.end()) {
+            if (nextUnlistedProduct == kUnlistedProductLimit) {
+                throw std::length_error("Too many products recorded by name only.");
+            }
+            it = unlistedProducts.emplace(std::string(product_name), nextUnlistedProduct++).first;
+        }
+        product_id = it->second;
+    }
+    recordPurchase(customer_id, product_id, product_name, quantity, total_cost);
+}
+
+// Append a purchase to the customer's history and the product's totals
+void CustomerManager::recordPurchase(int customer_id, int product_id, std::string_view product_name, int quantity, double total_cost) {
+    auto it = customerPurchases.find(customer_id);
+    if (it == customerPurchases.end()) {
         throw std::invalid_argument("Cannot add purchase: Customer not found.");
     }
-    customerPurchases[customer_id].addPurchase(product_name, quantity, total_cost);
+    // Keep the sales aggregates current so reports never have to walk every purchase; the
+    // totals are atomic, so only appends to the same history are serialised
+    productSales.recordSale(product_id, product_name, quantity, total_cost);
+    std::lock_guard<std::mutex> lock(purchaseLocks[static_cast<unsigned>(customer_id) % kPurchaseLockStripes]);
+    it->second.addPurchase(product_id, quantity, total_cost);
 }
 
 // Retrieve the purchase history of a customer
-const std::vector<PurchaseHistory::Purchase>& CustomerManager::getPurchaseHistory(int customer_id) const {
-    if (customerPurchases.find(customer_id) == customerPurchases.end()) {
+PurchaseHistory::View CustomerManager::getPurchaseHistory(int customer_id) const {
+    std::optional<PurchaseHistory::View> history = findPurchaseHistory(customer_id);
+    if (!history) {
         throw std::invalid_argument("No purchase history found for this customer.");
     }
-    return customerPurchases.at(customer_id).getHistory();
+    return *history;
+}
+
+// Retrieve the purchase history of a customer without throwing
+std::optional<PurchaseHistory::View> CustomerManager::findPurchaseHistory(int customer_id) const noexcept {
+    auto it = customerPurchases.find(customer_id);
+    if (it == customerPurchases.end() || it->second.getHistory().empty()) {
+        return std::nullopt;
+    }
+    return it->second.getHistory();
+}
+
+// Running totals for one customer
+PurchaseHistory::Totals CustomerManager::getPurchaseTotals(int customer_id) const {
+    auto it = customerPurchases.find(customer_id);
+    if (it == customerPurchases.end()) {
+        return PurchaseHistory::Totals();
+    }
+    std::lock_guard<std::mutex> lock(purchaseLocks[static_cast<unsigned>(customer_id) % kPurchaseLockStripes]);
+    return it->second.getTotals();
+}
+
+// The best-selling products by revenue
+std::vector<CustomerManager::ProductSales> CustomerManager::getTopProducts(std::size_t count) const {
+    std::vector<ProductSalesTable::Sales> sales = productSales.getSales();
+    std::vector<ProductSales> ranking;
+    ranking.reserve(sales.size());
+    for (const ProductSalesTable::Sales& product : sales) {
+        ranking.push_back({product.product_id, std::string_view(), {product.purchases, product.units, product.revenue}});
+    }
+
+    count = std::min(count, ranking.size());
+    std::partial_sort(ranking.begin(), ranking.begin() + count, ranking.end(),
+        [](const ProductSales& a, const ProductSales& b) {
+            return a.totals.revenue != b.totals.revenue ? a.totals.revenue > b.totals.revenue
+                                                        : a.product_id < b.product_id;
+        });
+    ranking.resize(count);
+    for (ProductSales& ranked : ranking) {
+        ranked.product_name = productSales.nameOf(ranked.product_id);
+    }
+    return ranking;
+}
+
+// Product names referenced by purchase histories
+const ProductSalesTable& CustomerManager::getProductSales() const {
+    return productSales;
 }
 
 // Retrieve all customers
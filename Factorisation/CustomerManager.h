@@ -1,32 +1,89 @@
 #ifndef CUSTOMER_MANAGER_H
 #define CUSTOMER_MANAGER_H
 
+#include <array>
+#include <limits>
 #include <map>
+#include <mutex>
+#include <optional>
+#include <string_view>
 #include <vector>
 #include <stdexcept>
+#include <string>
+#include "Arena.h"
 #include "Customer.h"
+#include "ProductSalesTable.h"
 #include "PurchaseHistory.h"
 
 class CustomerManager {
+public:
+    // Sales of one product across all customers
+    struct ProductSales {
+        int product_id;
+        std::string_view product_name; // Current name, resolved when the ranking is built
+        PurchaseHistory::Totals totals;
+    };
+
 private:
+    Arena<Customer> customerStorage;                     // Owns every Customer; freed in one go with the manager
     std::map<int, Customer*> customers;                  // Maps customer IDs to Customer objects
     std::map<int, PurchaseHistory> customerPurchases;    // Maps customer IDs to their purchase histories
+    ProductSalesTable productSales;                      // Names and sales totals of the products bought
 
-public:
-    // Destructor to clean up allocated memory
-    ~CustomerManager();
+    // Purchases recorded by name alone are filed under product IDs counted up from
+    // kUnlistedProductBase, one per distinct name, so they cannot collide with catalog
+    // products. A purchase added with an ID in that range (as StoreSnapshot::load restores
+    // them) claims the ID for its name, so later name-only purchases continue after it.
+    static constexpr int kUnlistedProductBase = std::numeric_limits<int>::min();
+    static constexpr int kUnlistedProductLimit = kUnlistedProductBase + (1 << 30);
+    std::map<std::string, int, std::less<>> unlistedProducts; // Name -> product ID
+    int nextUnlistedProduct = kUnlistedProductBase;
+    std::mutex unlistedProductsLock;
+
+    // Purchase histories are created with the customer, so concurrent purchases only need
+    // to serialise appends to the same history; customers are spread across these locks
+    static constexpr std::size_t kPurchaseLockStripes = 64;
+    mutable std::array<std::mutex, kPurchaseLockStripes> purchaseLocks;
 
-    // Add a new customer
+    void recordPurchase(int customer_id, int product_id, std::string_view product_name, int quantity, double total_cost);
+
+public:
+    // Add a new customer (the manager takes ownership and moves it into its own storage)
     void addCustomer(Customer* customer);
 
-    // Retrieve a customer by ID
+    // Construct a new customer directly in the manager's storage
+    Customer* emplaceCustomer(int customer_id, std::string_view name, std::string_view email);
+
+    // Retrieve a customer by ID (throws std::invalid_argument if it does not exist)
     Customer* getCustomer(int customer_id) const;
 
-    // Add a purchase record for a customer
-    void addPurchase(int customer_id, const std::string& product_name, int quantity, double total_cost);
+    // Retrieve a customer by ID, or nullptr if it does not exist
+    Customer* findCustomer(int customer_id) const noexcept;
+
+    // Add a purchase record for a customer (safe to call from several threads once all
+    // customers have been added). product_name is the product's current display name; it is
+    // only stored when it differs from the name already recorded for the product.
+    void addPurchase(int customer_id, int product_id, std::string_view product_name, int quantity, double total_cost);
+
+    // Add a purchase of a product that is known only by name
+    void addPurchase(int customer_id, std::string_view product_name, int quantity, double total_cost);
+
+    // Retrieve the purchase history of a customer (the view is invalidated by new purchases).
+    // Throws std::invalid_argument if the customer has no purchases.
+    PurchaseHistory::View getPurchaseHistory(int customer_id) const;
+
+    // Purchase history of a customer, or no value if the customer has no purchases
+    std::optional<PurchaseHistory::View> findPurchaseHistory(int customer_id) const noexcept;
+
+    // Running totals for one customer (all zero if they have not bought anything)
+    PurchaseHistory::Totals getPurchaseTotals(int customer_id) const;
+
+    // The best-selling products by revenue, highest first (ties by product ID). Names are
+    // looked up only for the products returned.
+    std::vector<ProductSales> getTopProducts(std::size_t count) const;
 
-    // Retrieve the purchase history of a customer
-    const std::vector<PurchaseHistory::Purchase>& getPurchaseHistory(int customer_id) const;
+    // Names and sales totals of the products in purchase histories
+    const ProductSalesTable& getProductSales() const;
 
     // Retrieve all customers
     const std::map<int, Customer*>& getAllCustomers() const;
@@ -1,27 +1,136 @@
 
 
 #include "Discount.h"
-#include <algorithm> // For std::max
+#include <algorithm> // For std::max, std::min
+#include <limits>
+#include <memory>
 
 // Adheres to OCP: Encapsulates discount logic, enabling extension to new discount types 
 // (e.g., seasonal, bundled discounts) without modifying existing functionality.
+// Discount types are resolved once, when the discount is created, rather than on every price.
+
+namespace {
+
+// Apply rules in order
+double applySteps(const Discount::Step* steps, std::size_t stepCount, double originalPrice) {
+    double price = originalPrice;
+    for (std::size_t i = 0; i < stepCount; ++i) {
+        const Discount::Step& step = steps[i];
+        switch (step.rule) {
+            case Discount::Rule::None:
+                break;
+            case Discount::Rule::Flat:
+                price = std::max(0.0, price - step.value); // Ensure price doesn't go below zero
+                break;
+            case Discount::Rule::Percentage:
+                price = std::max(0.0, price * (1 - step.value / 100)); // Apply percentage discount
+                break;
+            case Discount::Rule::MinimumPrice:
+                price = std::max(price, std::min(step.value, originalPrice));
+                break;
+            case Discount::Rule::MaxSavings:
+                price = std::max(price, originalPrice - step.value);
+                break;
+            case Discount::Rule::Invalid:
+                throw std::invalid_argument("Invalid discount type"); // Invalid type
+        }
+    }
+    return price;
+}
+
+} // namespace
 
 // Default constructor
-Discount::Discount() : type("none"), value(0.0) {}
+Discount::Discount() : Discount(Rule::None, 0.0) {}
 
 // Constructor with parameters
 Discount::Discount(const std::string& discountType, double discountValue)
-    : type(discountType), value(discountValue) {}
+    : Discount(parseRule(discountType), discountValue) {}
+
+Discount::Discount(Rule rule, double value) : rule(rule), stepCount(1), value(value) {}
+
+// Copying duplicates the rule array of a multi-rule discount
+Discount::Discount(const Discount& other) : rule(other.rule), stepCount(other.stepCount), value(other.value) {
+    if (other.steps) {
+        steps = std::make_unique<Step[]>(stepCount);
+        std::copy(other.steps.get(), other.steps.get() + stepCount, steps.get());
+    }
+}
+
+Discount& Discount::operator=(const Discount& other) {
+    if (this != &other) {
+        *this = Discount(other);
+    }
+    return *this;
+}
+
+// Add another rule
+Discount& Discount::then(Rule nextRule, double nextValue) {
+    if (stepCount == kMaxSteps) {
+        throw std::length_error("Too many discount rules");
+    }
+    std::unique_ptr<Step[]> next = std::make_unique<Step[]>(stepCount + 1u);
+    for (std::size_t i = 0; i < stepCount; ++i) {
+        next[i] = getStep(i);
+    }
+    next[stepCount] = Step{nextRule, nextValue};
+    steps = std::move(next);
+    ++stepCount;
+    rule = Rule::None;
+    value = 0.0;
+    return *this;
+}
 
 // Apply discount to a price
 double Discount::applyDiscount(double originalPrice) const {
-    if (type == "flat") {
-        return std::max(0.0, originalPrice - value); // Ensure price doesn't go below zero
-    } else if (type == "percentage") {
-        return std::max(0.0, originalPrice * (1 - value / 100)); // Apply percentage discount
-    } else if (type == "none") {
-        return originalPrice; // No discount applied
-    } else {
-        throw std::invalid_argument("Invalid discount type"); // Invalid type
+    double multiplier, subtrahend, floor;
+    if (getLinearForm(multiplier, subtrahend, floor)) {
+        return std::max(floor, originalPrice * multiplier - subtrahend);
+    }
+    if (stepCount == 1) {
+        Step single{rule, value};
+        return applySteps(&single, 1, originalPrice);
+    }
+    return applySteps(steps.get(), stepCount, originalPrice);
+}
+
+// Rules, in the order they are applied
+std::size_t Discount::getStepCount() const {
+    return stepCount;
+}
+
+Discount::Step Discount::getStep(std::size_t index) const {
+    if (index >= stepCount) {
+        throw std::out_of_range("Discount step index out of range");
+    }
+    return stepCount == 1 ? Step{rule, value} : steps[index];
+}
+
+// Single-rule linear form, used by applyDiscount and the bulk repricing kernels. The three
+// linear rules are told apart with selects rather than a switch; the results are exactly
+// those of the rule-by-rule loop.
+bool Discount::getLinearForm(double& linearMultiplier, double& linearSubtrahend, double& linearFloor) const {
+    if (stepCount != 1 || rule > Rule::Percentage) {
+        return false; // Needs the original price or throws; use the general loop
+    }
+    linearMultiplier = rule == Rule::Percentage ? 1 - value / 100 : 1.0;
+    linearSubtrahend = rule == Rule::Flat ? value : 0.0;
+    linearFloor = rule == Rule::None ? -std::numeric_limits<double>::infinity() : 0.0;
+    return true;
+}
+
+// Map the discount type names to rules
+Discount::Rule Discount::parseRule(std::string_view discountType) {
+    if (discountType == "flat") {
+        return Rule::Flat;
+    } else if (discountType == "percentage") {
+        return Rule::Percentage;
+    } else if (discountType == "none") {
+        return Rule::None;
+    } else if (discountType == "minimum_price") {
+        return Rule::MinimumPrice;
+    } else if (discountType == "max_savings") {
+        return Rule::MaxSavings;
     }
+    return Rule::Invalid; // Reported when the discount is applied, as before
 }
@@ -3,21 +3,68 @@
 #ifndef DISCOUNT_H
 #define DISCOUNT_H
 
+#include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <string>
+#include <string_view>
 #include <stdexcept>
 
+// A discount: a short list of pricing rules applied in order.
+// The common single rule is kept inline as its type and value, so a Discount is 24 bytes and
+// sits next to its product in the catalog. Discounts with several rules keep them in an array
+// of their own, freed with the discount when it is replaced.
 class Discount {
-private:
-    std::string type; // "flat" or "percentage"
-    double value;     // Discount value in dollars or percentage
-
 public:
+    enum class Rule : std::uint8_t {
+        None,         // Price unchanged
+        Flat,         // Subtract value, never below zero
+        Percentage,   // Take value percent off, never below zero
+        MinimumPrice, // Never go below value (or the original price, if that is lower)
+        MaxSavings,   // Never take off more than value in total
+        Invalid       // Unknown discount type; applying it throws
+    };
+
+    struct Step {
+        Rule rule;
+        double value;
+    };
+
+    static constexpr std::size_t kMaxSteps = 4;
+
     // Constructors
     Discount();
-    Discount(const std::string& discountType, double discountValue);
+    Discount(const std::string& discountType, double discountValue); // "flat", "percentage" or "none"
+    Discount(Rule rule, double value);
+    Discount(const Discount& other);
+    Discount(Discount&& other) noexcept = default;
+    Discount& operator=(const Discount& other);
+    Discount& operator=(Discount&& other) noexcept = default;
+
+    // Rule for a name: "none", "flat", "percentage", "minimum_price" or "max_savings";
+    // anything else is Rule::Invalid
+    static Rule parseRule(std::string_view name);
+
+    // Add another rule, applied to the result of the rules before it
+    Discount& then(Rule rule, double value);
 
     // Apply discount to a price
     double applyDiscount(double originalPrice) const;
+
+    // Rules, in the order they are applied
+    std::size_t getStepCount() const;
+    Step getStep(std::size_t index) const;
+
+    // For single-rule discounts, the price is max(floor, price * multiplier - subtrahend);
+    // returns false (leaving the outputs alone) when the rules need the general evaluation.
+    // applyDiscount takes the same path, so a single rule is priced without a switch.
+    bool getLinearForm(double& linearMultiplier, double& linearSubtrahend, double& linearFloor) const;
+
+private:
+    Rule rule;                      // The rule, when there is only one
+    std::uint8_t stepCount;
+    double value;                   // The rule's value, when there is only one
+    std::unique_ptr<Step[]> steps;  // Every rule, when there is more than one
 };
 
 #endif // DISCOUNT_H
@@ -0,0 +1,74 @@
+
+
+#include "FactorKernels.h"
+#include <algorithm> // For std::sort
+
+namespace {
+
+// Gaps between consecutive numbers coprime to 30, starting from 7
+constexpr std::uint8_t kWheelGaps[8] = {4, 2, 4, 2, 4, 6, 2, 6};
+
+void splitWithRho(std::uint64_t n, std::vector<std::uint64_t>& factors) {
+    if (n == 1) {
+        return;
+    }
+    if (isPrime(n)) {
+        factors.push_back(n);
+        return;
+    }
+    std::uint64_t divisor = brentDivisor(n);
+    splitWithRho(divisor, factors);
+    splitWithRho(n / divisor, factors);
+}
+
+} // namespace
+
+// Divide out primes below limit
+std::uint64_t removeSmallFactors(std::uint64_t n, std::uint64_t limit, std::vector<std::uint64_t>& factors) {
+    for (std::uint64_t p : {2u, 3u, 5u}) {
+        if (p >= limit) {
+            return n;
+        }
+        while (n % p == 0) {
+            factors.push_back(p);
+            n /= p;
+        }
+    }
+    std::uint64_t candidate = 7;
+    for (std::size_t gap = 0; candidate < limit && candidate <= n / candidate; gap = (gap + 1) % 8) {
+        while (n % candidate == 0) {
+            factors.push_back(candidate);
+            n /= candidate;
+        }
+        candidate += kWheelGaps[gap];
+    }
+    if (n > 1 && candidate > n / candidate) {
+        // Every prime up to the square root of n has been tried, so n is prime
+        factors.push_back(n);
+        return 1;
+    }
+    return n;
+}
+
+// Trial division up to the square root
+void trialDivisionFactors(std::uint64_t n, std::vector<std::uint64_t>& factors) {
+    if (n < 2) {
+        return;
+    }
+    std::uint64_t rest = removeSmallFactors(n, UINT64_MAX, factors);
+    if (rest > 1) {
+        factors.push_back(rest);
+    }
+}
+
+// Pollard's rho with Miller-Rabin
+void pollardRhoFactors(std::uint64_t n, std::vector<std::uint64_t>& factors) {
+    if (n < 2) {
+        return;
+    }
+    std::size_t first = factors.size();
+    // Small primes are cheaper to find by division than by rho
+    std::uint64_t rest = removeSmallFactors(n, 64, factors);
+    splitWithRho(rest, factors);
+    std::sort(factors.begin() + static_cast<std::ptrdiff_t>(first), factors.end());
+}
@@ -0,0 +1,211 @@
+
+
+#ifndef FACTOR_KERNELS_H
+#define FACTOR_KERNELS_H
+
+#include <algorithm> // For std::min
+#include <cstdint>
+#include <numeric> // For std::gcd
+#include <vector>
+
+// Integer factorization building blocks shared by the FactoringMethod engines.
+// The arithmetic and primality kernels are constexpr, so compile-time factorization
+// (StaticSieve.h) uses the same code; every factor-appending kernel appends prime factors in
+// ascending order, with multiplicity.
+
+__extension__ using WideUnsigned = unsigned __int128;
+
+// (a * b) mod m without overflow
+constexpr std::uint64_t mulMod(std::uint64_t a, std::uint64_t b, std::uint64_t m) {
+    if (m <= 0xFFFFFFFFu) {
+        return a * b % m; // Both operands are below 2^32
+    }
+    return static_cast<std::uint64_t>(static_cast<WideUnsigned>(a) * b % m);
+}
+
+// (base ^ exponent) mod m
+constexpr std::uint64_t powMod(std::uint64_t base, std::uint64_t exponent, std::uint64_t m) {
+    std::uint64_t result = 1 % m;
+    base %= m;
+    while (exponent != 0) {
+        if (exponent & 1) {
+            result = mulMod(result, base, m);
+        }
+        base = mulMod(base, base, m);
+        exponent >>= 1;
+    }
+    return result;
+}
+
+// Arithmetic modulo an odd n in Montgomery form (x is held as x * 2^64 mod n), which replaces
+// the 128-bit division of mulMod with multiplications
+class Montgomery {
+public:
+    constexpr explicit Montgomery(std::uint64_t modulus) : n(modulus), inverse(modulus) {
+        for (int i = 0; i < 5; ++i) {
+            inverse *= 2 - modulus * inverse; // Newton's iteration doubles the correct low bits
+        }
+        one = to(1);
+        minusOne = n - one;
+    }
+
+    constexpr std::uint64_t to(std::uint64_t value) const {
+        return static_cast<std::uint64_t>((static_cast<WideUnsigned>(value % n) << 64) % n);
+    }
+
+    // a * b / 2^64 mod n
+    constexpr std::uint64_t multiply(std::uint64_t a, std::uint64_t b) const {
+        WideUnsigned product = static_cast<WideUnsigned>(a) * b;
+        std::uint64_t m = static_cast<std::uint64_t>(product) * inverse;
+        std::uint64_t high = static_cast<std::uint64_t>(product >> 64);
+        std::uint64_t correction = static_cast<std::uint64_t>((static_cast<WideUnsigned>(m) * n) >> 64);
+        return high >= correction ? high - correction : high + (n - correction);
+    }
+
+    constexpr std::uint64_t power(std::uint64_t base, std::uint64_t exponent) const {
+        std::uint64_t result = one;
+        while (exponent != 0) {
+            if (exponent & 1) {
+                result = multiply(result, base);
+            }
+            base = multiply(base, base);
+            exponent >>= 1;
+        }
+        return result;
+    }
+
+    std::uint64_t n;
+    std::uint64_t inverse; // n^-1 mod 2^64
+    std::uint64_t one = 0;
+    std::uint64_t minusOne = 0;
+};
+
+// Miller-Rabin rounds: true if base a proves n (with n - 1 = d * 2^s, d odd) composite
+constexpr bool montgomeryWitness(const Montgomery& mont, std::uint64_t d, int s, std::uint64_t a) {
+    std::uint64_t base = mont.to(a);
+    if (base == 0) {
+        return false;
+    }
+    std::uint64_t x = mont.power(base, d);
+    if (x == mont.one || x == mont.minusOne) {
+        return false;
+    }
+    for (int r = 1; r < s; ++r) {
+        x = mont.multiply(x, x);
+        if (x == mont.minusOne) {
+            return false;
+        }
+    }
+    return true;
+}
+
+constexpr bool millerRabinWitness(std::uint64_t n, std::uint64_t d, int s, std::uint64_t a) {
+    a %= n;
+    if (a == 0) {
+        return false; // Base is a multiple of n; says nothing
+    }
+    std::uint64_t x = powMod(a, d, n);
+    if (x == 1 || x == n - 1) {
+        return false;
+    }
+    for (int r = 1; r < s; ++r) {
+        x = mulMod(x, x, n);
+        if (x == n - 1) {
+            return false;
+        }
+    }
+    return true; // a proves n composite
+}
+
+// A nontrivial divisor of the odd composite n. The walk runs in Montgomery form: x -> x^2 + c
+// there is still a pseudo-random map, and the gcd with n is unchanged by the 2^64 factors.
+constexpr std::uint64_t brentDivisor(std::uint64_t n) {
+    constexpr std::uint64_t kBatch = 128; // Products of differences taken before each gcd
+    Montgomery mont(n);
+    for (std::uint64_t c = 1;; ++c) {
+        auto step = [&mont, n, c](std::uint64_t value) {
+            std::uint64_t next = mont.multiply(value, value) + c;
+            return next < c || next >= n ? next - n : next; // Wraps at most once
+        };
+        auto distance = [](std::uint64_t a, std::uint64_t b) { return a > b ? a - b : b - a; };
+        std::uint64_t y = mont.one + 1, x = y, saved = y, product = mont.one, divisor = 1;
+        for (std::uint64_t length = 1; divisor == 1; length <<= 1) {
+            x = y;
+            for (std::uint64_t i = 0; i < length; ++i) {
+                y = step(y);
+            }
+            for (std::uint64_t done = 0; done < length && divisor == 1; done += kBatch) {
+                saved = y;
+                std::uint64_t batch = std::min(kBatch, length - done);
+                for (std::uint64_t i = 0; i < batch; ++i) {
+                    y = step(y);
+                    product = mont.multiply(product, distance(x, y));
+                }
+                divisor = std::gcd(product, n);
+            }
+        }
+        if (divisor == n) {
+            // The batch overshot; retrace it one step at a time
+            do {
+                saved = step(saved);
+                divisor = std::gcd(distance(x, saved), n);
+            } while (divisor == 1);
+        }
+        if (divisor != n) {
+            return divisor;
+        }
+        // This polynomial cycled without splitting n; try the next constant
+    }
+}
+
+// Deterministic Miller-Rabin primality test, exact for every 64-bit number
+constexpr bool isPrime(std::uint64_t n) {
+    if (n < 2) {
+        return false;
+    }
+    for (std::uint64_t p : {2u, 3u, 5u, 7u, 11u, 13u, 17u, 19u, 23u, 29u, 31u, 37u}) {
+        if (n % p == 0) {
+            return n == p;
+        }
+    }
+    if (n < 41 * 41) {
+        return true;
+    }
+    std::uint64_t d = n - 1;
+    int s = 0;
+    while ((d & 1) == 0) {
+        d >>= 1;
+        ++s;
+    }
+    if (n <= 0xFFFFFFFFu) {
+        // These bases are exact below 2^32
+        for (std::uint64_t a : {2u, 7u, 61u}) {
+            if (millerRabinWitness(n, d, s, a)) {
+                return false;
+            }
+        }
+        return true;
+    }
+    // These bases are exact for every 64-bit number
+    Montgomery mont(n);
+    for (std::uint64_t a : {2ull, 325ull, 9375ull, 28178ull, 450775ull, 9780504ull, 1795265022ull}) {
+        if (montgomeryWitness(mont, d, s, a)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+// Trial division by 2, 3, 5 and then a mod-30 wheel, up to the square root of n
+void trialDivisionFactors(std::uint64_t n, std::vector<std::uint64_t>& factors);
+
+// Divide out primes below limit (wheel trial division); returns the cofactor, which has no
+// prime factor below limit
+std::uint64_t removeSmallFactors(std::uint64_t n, std::uint64_t limit, std::vector<std::uint64_t>& factors);
+
+// Split n with Pollard's rho (Brent's variant) and Miller-Rabin; fastest for large n with
+// large prime factors
+void pollardRhoFactors(std::uint64_t n, std::vector<std::uint64_t>& factors);
+
+#endif // FACTOR_KERNELS_H
@@ -0,0 +1,21 @@
+
+
+#include "FactoringMethod.h"
+#include "FactorizationBatch.h"
+
+// Factor an int through the 64-bit overload; every factor of an int fits in an int
+std::vector<int> FactoringMethod::factorize(int number) const {
+    if (number < 2) {
+        return {};
+    }
+    std::vector<std::uint64_t> wide = factorize(static_cast<std::uint64_t>(number));
+    return std::vector<int>(wide.begin(), wide.end());
+}
+
+// Factor many numbers through the single-number overload
+void FactoringMethod::factorizeBatch(std::span<const std::uint64_t> numbers, FactorizationBatch& out, ThreadPool* pool) const {
+    factorizeInParallel(numbers, out, pool, [this](std::uint64_t number, std::vector<std::uint64_t>& factors) {
+        std::vector<std::uint64_t> found = factorize(number);
+        factors.insert(factors.end(), found.begin(), found.end());
+    });
+}
@@ -1,12 +1,41 @@
 #ifndef FACTORING_METHOD_H
 #define FACTORING_METHOD_H
 
+#include <concepts>
+#include <cstdint>
+#include <span>
 #include <vector>
 
+class ThreadPool;
+struct FactorizationBatch;
+
+// A way of splitting a number into prime factors. Factors come back in ascending order with
+// multiplicity (12 -> 2, 2, 3); numbers below 2 have none.
 class FactoringMethod {
 public:
+    // Defaults to the 64-bit overload
+    virtual std::vector<int> factorize(int number) const;
+
     // Pure virtual function to be implemented by subclasses
-    virtual std::vector<int> factorize(int number) const = 0;
+    virtual std::vector<std::uint64_t> factorize(std::uint64_t number) const = 0;
+
+    // Every other integer type (unsigned, long, long long, ...) goes to the 64-bit overload,
+    // so calls with them are not ambiguous between the two above
+    template <std::integral Integer>
+        requires (!std::same_as<Integer, int> && !std::same_as<Integer, std::uint64_t> && !std::same_as<Integer, bool>)
+    std::vector<std::uint64_t> factorize(Integer number) const {
+        if (number < 2) {
+            return {}; // Also keeps negative numbers from wrapping around
+        }
+        return factorize(static_cast<std::uint64_t>(number));
+    }
+
+    // Factor many numbers with one call into a flat buffer (see FactorizationBatch), in
+    // parallel with work stealing when a pool is given. The default calls factorize per
+    // number; the engines override it with their kernels, so there is no virtual call or
+    // allocation per number.
+    virtual void factorizeBatch(std::span<const std::uint64_t> numbers, FactorizationBatch& out, ThreadPool* pool = nullptr) const;
+
     virtual ~FactoringMethod() = default;
 };
 
@@ -0,0 +1,146 @@
+
+
+#ifndef FACTORIZATION_BATCH_H
+#define FACTORIZATION_BATCH_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <vector>
+#include "ThreadPool.h"
+
+// Factors of many numbers in one flat buffer: the factors of the i-th number are
+// factors[offsets[i]] up to (not including) factors[offsets[i + 1]].
+struct FactorizationBatch {
+    std::vector<std::uint64_t> factors;
+    std::vector<std::size_t> offsets;
+
+    // Number of numbers factored
+    std::size_t size() const { return offsets.empty() ? 0 : offsets.size() - 1; }
+
+    std::span<const std::uint64_t> factorsOf(std::size_t index) const {
+        return std::span<const std::uint64_t>(factors.data() + offsets[index], offsets[index + 1] - offsets[index]);
+    }
+};
+
+// Factor every number with appendFactors(number, factors), which appends the factors of one
+// number to a vector, and collect the results in out.
+// With a thread pool, one worker per pool thread starts on an equal share of the numbers and,
+// once its share is done, steals half of whatever is left of the largest remaining share, so
+// a few expensive inputs cannot leave the other threads idle. Each worker's share is a
+// [begin, end) index range packed into one atomic word: the owner takes from the front, thieves
+// split off the back. Workers append into their own buffers, which are stitched into input
+// order at the end, so nothing is allocated per number.
+template <typename AppendFactors>
+void factorizeInParallel(std::span<const std::uint64_t> numbers, FactorizationBatch& out, ThreadPool* pool,
+                         AppendFactors appendFactors) {
+    constexpr std::size_t kGrain = 8; // Numbers an owner takes from its share at a time
+    if (numbers.size() >= (std::size_t{1} << 32)) {
+        throw std::length_error("Too many numbers in one factorization batch");
+    }
+
+    struct Found {
+        std::uint32_t index;
+        std::uint32_t count;
+    };
+    struct Worker {
+        alignas(64) std::atomic<std::uint64_t> range{0}; // begin << 32 | end
+        std::vector<std::uint64_t> factors;
+        std::vector<Found> found;
+    };
+    auto pack = [](std::uint64_t begin, std::uint64_t end) { return begin << 32 | end; };
+    auto beginOf = [](std::uint64_t range) { return range >> 32; };
+    auto endOf = [](std::uint64_t range) { return range & 0xFFFFFFFFu; };
+
+    std::size_t workerCount = pool == nullptr ? 1 : std::max<std::size_t>(1, std::min(pool->size(), numbers.size()));
+    std::unique_ptr<Worker[]> workers(new Worker[workerCount]);
+    for (std::size_t w = 0; w < workerCount; ++w) {
+        workers[w].range.store(pack(numbers.size() * w / workerCount, numbers.size() * (w + 1) / workerCount));
+    }
+
+    auto work = [&](std::size_t self) {
+        Worker& mine = workers[self];
+        while (true) {
+            // Take the next few numbers from the front of our own share
+            std::uint64_t range = mine.range.load();
+            while (beginOf(range) < endOf(range)) {
+                std::uint64_t take = std::min<std::uint64_t>(kGrain, endOf(range) - beginOf(range));
+                if (!mine.range.compare_exchange_weak(range, pack(beginOf(range) + take, endOf(range)))) {
+                    continue; // A thief moved the end; retry with the new range
+                }
+                for (std::uint64_t i = beginOf(range); i < beginOf(range) + take; ++i) {
+                    std::size_t before = mine.factors.size();
+                    appendFactors(numbers[i], mine.factors);
+                    mine.found.push_back(Found{static_cast<std::uint32_t>(i), static_cast<std::uint32_t>(mine.factors.size() - before)});
+                }
+                range = mine.range.load();
+            }
+
+            // Our share is empty: steal the back half of the largest remaining share
+            bool stole = false;
+            while (!stole) {
+                std::size_t victim = workerCount;
+                std::uint64_t victimRange = 0;
+                for (std::size_t w = 0; w < workerCount; ++w) {
+                    std::uint64_t candidate = workers[w].range.load();
+                    if (w != self && endOf(candidate) - beginOf(candidate) >
+                                         (victim == workerCount ? 0 : endOf(victimRange) - beginOf(victimRange))) {
+                        victim = w;
+                        victimRange = candidate;
+                    }
+                }
+                if (victim == workerCount) {
+                    return; // Nothing left anywhere
+                }
+                std::uint64_t remaining = endOf(victimRange) - beginOf(victimRange);
+                std::uint64_t split = endOf(victimRange) - (remaining + 1) / 2;
+                if (workers[victim].range.compare_exchange_strong(victimRange, pack(beginOf(victimRange), split))) {
+                    mine.range.store(pack(split, endOf(victimRange)));
+                    stole = true;
+                }
+            }
+        }
+    };
+
+    if (workerCount == 1) {
+        work(0);
+    } else {
+        std::vector<std::future<void>> running;
+        running.reserve(workerCount);
+        for (std::size_t w = 0; w < workerCount; ++w) {
+            running.push_back(pool->submit([&work, w] { work(w); }));
+        }
+        for (auto& worker : running) {
+            worker.wait(); // Every worker must stop before the shared state goes away
+        }
+        for (auto& worker : running) {
+            worker.get();
+        }
+    }
+
+    // Stitch the workers' results into input order
+    out.offsets.assign(numbers.size() + 1, 0);
+    for (std::size_t w = 0; w < workerCount; ++w) {
+        for (const Found& found : workers[w].found) {
+            out.offsets[found.index + 1] = found.count;
+        }
+    }
+    for (std::size_t i = 0; i < numbers.size(); ++i) {
+        out.offsets[i + 1] += out.offsets[i];
+    }
+    out.factors.resize(out.offsets.back());
+    for (std::size_t w = 0; w < workerCount; ++w) {
+        const std::uint64_t* source = workers[w].factors.data();
+        for (const Found& found : workers[w].found) {
+            std::copy_n(source, found.count, out.factors.data() + out.offsets[found.index]);
+            source += found.count;
+        }
+    }
+}
+
+#endif // FACTORIZATION_BATCH_H
@@ -0,0 +1,18 @@
+
+
+#include "FormatUtils.h"
+#include <charconv>
+
+// Append an integer in decimal
+void appendInteger(std::string& out, long long value) {
+    char digits[24];
+    auto result = std::to_chars(digits, digits + sizeof(digits), value);
+    out.append(digits, result.ptr);
+}
+
+// Append a number with exactly two decimals
+void appendFixed2(std::string& out, double value) {
+    char digits[352]; // Enough for the largest double in fixed notation
+    auto result = std::to_chars(digits, digits + sizeof(digits), value, std::chars_format::fixed, 2);
+    out.append(digits, result.ptr);
+}
@@ -0,0 +1,17 @@
+
+
+#ifndef FORMAT_UTILS_H
+#define FORMAT_UTILS_H
+
+#include <string>
+
+// Locale-free number formatting that appends to an existing buffer, for hot paths that
+// would otherwise build a std::ostringstream per line.
+
+// Append an integer in decimal
+void appendInteger(std::string& out, long long value);
+
+// Append a number with exactly two decimals (same text as std::fixed << std::setprecision(2))
+void appendFixed2(std::string& out, double value);
+
+#endif // FORMAT_UTILS_H
@@ -0,0 +1,172 @@
+
+
+#include "Instrumentation.h"
+#include <algorithm> // For std::fill, std::max
+#include <bit>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+
+// Instrumentation: Collects per-thread stage timings and merges them into statistics
+// Adheres to SRP: Only measures and summarises; the timed code decides what a stage is.
+
+namespace {
+
+constexpr std::size_t kStageCount = static_cast<std::size_t>(Stage::Count);
+
+struct ThreadHistograms {
+    std::array<LatencyHistogram, kStageCount> stages;
+};
+
+// Every thread's histograms. They are kept after the thread exits so its timings still count.
+struct Registry {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<ThreadHistograms>> threads;
+    std::atomic<std::chrono::steady_clock::rep> epoch{std::chrono::steady_clock::now().time_since_epoch().count()};
+};
+
+Registry& registry() {
+    static Registry* instance = new Registry(); // Never destroyed, so threads may record during shutdown
+    return *instance;
+}
+
+// The calling thread's histograms, registered on its first timing
+ThreadHistograms& localHistograms() {
+    thread_local ThreadHistograms* histograms = [] {
+        Registry& shared = registry();
+        std::lock_guard<std::mutex> lock(shared.mutex);
+        shared.threads.push_back(std::make_unique<ThreadHistograms>());
+        return shared.threads.back().get();
+    }();
+    return *histograms;
+}
+
+// Smallest value with at least fraction of the samples at or below it
+std::uint64_t percentile(const std::vector<std::uint64_t>& counts, std::uint64_t total, double fraction) {
+    std::uint64_t rank = static_cast<std::uint64_t>(fraction * static_cast<double>(total) + 0.5);
+    rank = rank == 0 ? 1 : rank;
+    std::uint64_t seen = 0;
+    for (std::size_t bucket = 0; bucket < counts.size(); ++bucket) {
+        seen += counts[bucket];
+        if (seen >= rank) {
+            return LatencyHistogram::bucketUpperBound(bucket);
+        }
+    }
+    return 0;
+}
+
+} // namespace
+
+// Display name of a stage
+const char* stageName(Stage stage) {
+    switch (stage) {
+    case Stage::PurchaseLookup: return "purchase.lookup";
+    case Stage::PurchaseDiscount: return "purchase.discount";
+    case Stage::PurchaseStock: return "purchase.stock";
+    case Stage::PurchaseHistory: return "purchase.history";
+    case Stage::PurchaseReceipt: return "purchase.receipt";
+    case Stage::Purchase: return "purchase";
+    case Stage::InventoryReport: return "report.inventory";
+    case Stage::SalesReport: return "report.sales";
+    case Stage::Count: break;
+    }
+    return "unknown";
+}
+
+// Bucket index: exact below 64, then 32 buckets per power of two
+std::size_t LatencyHistogram::bucketOf(std::uint64_t nanoseconds) {
+    if (nanoseconds < 2 * kSubBuckets) {
+        return static_cast<std::size_t>(nanoseconds);
+    }
+    int shift = std::bit_width(nanoseconds) - 6;
+    std::size_t top = static_cast<std::size_t>(nanoseconds >> shift); // In [32, 64)
+    return 2 * kSubBuckets + static_cast<std::size_t>(shift - 1) * kSubBuckets + (top - kSubBuckets);
+}
+
+// Largest value that falls in a bucket
+std::uint64_t LatencyHistogram::bucketUpperBound(std::size_t bucket) {
+    if (bucket < 2 * kSubBuckets) {
+        return bucket;
+    }
+    std::size_t shift = (bucket - 2 * kSubBuckets) / kSubBuckets + 1;
+    std::uint64_t top = (bucket - 2 * kSubBuckets) % kSubBuckets + kSubBuckets;
+    return ((top + 1) << shift) - 1;
+}
+
+// Clear all counts
+void LatencyHistogram::reset() {
+    for (auto& count : counts) {
+        count.store(0, std::memory_order_relaxed);
+    }
+    total.store(0, std::memory_order_relaxed);
+    maximum.store(0, std::memory_order_relaxed);
+}
+
+// Record one timing for the calling thread
+void Instrumentation::record(Stage stage, std::uint64_t nanoseconds) {
+    localHistograms().stages[static_cast<std::size_t>(stage)].record(nanoseconds);
+}
+
+// Merge every thread's histograms, stage by stage
+std::vector<StageStats> Instrumentation::snapshot() {
+    Registry& shared = registry();
+    std::lock_guard<std::mutex> lock(shared.mutex);
+    double elapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch() -
+        std::chrono::steady_clock::duration(shared.epoch.load(std::memory_order_relaxed))).count();
+
+    std::vector<StageStats> stats;
+    std::vector<std::uint64_t> counts(LatencyHistogram::kBucketCount);
+    for (std::size_t stage = 0; stage < kStageCount; ++stage) {
+        std::fill(counts.begin(), counts.end(), 0);
+        std::uint64_t count = 0, totalNanoseconds = 0, maxNanoseconds = 0;
+        for (const auto& thread : shared.threads) {
+            const LatencyHistogram& histogram = thread->stages[stage];
+            for (std::size_t bucket = 0; bucket < counts.size(); ++bucket) {
+                std::uint64_t inBucket = histogram.countIn(bucket);
+                counts[bucket] += inBucket;
+                count += inBucket;
+            }
+            totalNanoseconds += histogram.totalNanoseconds();
+            maxNanoseconds = std::max(maxNanoseconds, histogram.maxNanoseconds());
+        }
+        if (count == 0) {
+            continue;
+        }
+        // A bucket's upper bound can exceed the largest value actually recorded in it
+        auto quantile = [&](double fraction) { return std::min(percentile(counts, count, fraction), maxNanoseconds); };
+        stats.push_back({static_cast<Stage>(stage), count, static_cast<double>(totalNanoseconds) / count,
+                         quantile(0.50), quantile(0.99), quantile(0.999), maxNanoseconds,
+                         elapsedSeconds > 0 ? count / elapsedSeconds : 0.0});
+    }
+    return stats;
+}
+
+// Statistics as a table
+std::string Instrumentation::dump() {
+    std::string text;
+    char line[192];
+    std::snprintf(line, sizeof(line), "%-20s %12s %12s %10s %10s %10s %12s %14s\n",
+                  "stage", "count", "mean ns", "p50 ns", "p99 ns", "p999 ns", "max ns", "calls/s");
+    text += line;
+    for (const StageStats& stage : snapshot()) {
+        std::snprintf(line, sizeof(line), "%-20s %12llu %12.1f %10llu %10llu %10llu %12llu %14.0f\n",
+                      stageName(stage.stage), static_cast<unsigned long long>(stage.count), stage.meanNanoseconds,
+                      static_cast<unsigned long long>(stage.p50Nanoseconds), static_cast<unsigned long long>(stage.p99Nanoseconds),
+                      static_cast<unsigned long long>(stage.p999Nanoseconds), static_cast<unsigned long long>(stage.maxNanoseconds),
+                      stage.perSecond);
+        text += line;
+    }
+    return text;
+}
+
+// Clear all timings
+void Instrumentation::reset() {
+    Registry& shared = registry();
+    std::lock_guard<std::mutex> lock(shared.mutex);
+    for (const auto& thread : shared.threads) {
+        for (LatencyHistogram& histogram : thread->stages) {
+            histogram.reset();
+        }
+    }
+    shared.epoch.store(std::chrono::steady_clock::now().time_since_epoch().count(), std::memory_order_relaxed);
+}
@@ -0,0 +1,147 @@
+
+
+#ifndef INSTRUMENTATION_H
+#define INSTRUMENTATION_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Hot-path timing. Code is timed through the FACTORISATION_* macros at the end of this file,
+// which expand to nothing unless FACTORISATION_INSTRUMENTATION is defined (the CMake option of
+// the same name), so an uninstrumented build carries no trace of them. Recording is lock-free:
+// every thread writes only its own histograms, and readers merge them.
+
+// What is being timed
+enum class Stage : std::uint8_t {
+    PurchaseLookup,   // Finding the product and customer
+    PurchaseDiscount, // Computing the discounted price
+    PurchaseStock,    // Reserving stock
+    PurchaseHistory,  // Appending to the purchase history (and journal)
+    PurchaseReceipt,  // Formatting the details and receipt and handing them to the sink
+    Purchase,         // The whole of Transaction::processPurchase
+    InventoryReport,  // InventoryReport::generate
+    SalesReport,      // SalesReport::generate
+    Count
+};
+
+// Display name of a stage
+const char* stageName(Stage stage);
+
+// Latency histogram with HDR-style log-linear buckets: values below 64 ns are exact, larger
+// values land in one of 32 buckets per power of two (at most about 3% above the true value).
+// One thread records; any thread may read.
+class LatencyHistogram {
+public:
+    static constexpr std::size_t kSubBuckets = 32;
+    static constexpr std::size_t kBucketCount = 2 * kSubBuckets + 58 * kSubBuckets;
+
+    // Add one value (single writer: plain loads and stores, no read-modify-write)
+    void record(std::uint64_t nanoseconds) {
+        std::atomic<std::uint64_t>& bucket = counts[bucketOf(nanoseconds)];
+        bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        total.store(total.load(std::memory_order_relaxed) + nanoseconds, std::memory_order_relaxed);
+        if (nanoseconds > maximum.load(std::memory_order_relaxed)) {
+            maximum.store(nanoseconds, std::memory_order_relaxed);
+        }
+    }
+
+    static std::size_t bucketOf(std::uint64_t nanoseconds);
+    static std::uint64_t bucketUpperBound(std::size_t bucket); // Largest value in the bucket
+
+    std::uint64_t countIn(std::size_t bucket) const { return counts[bucket].load(std::memory_order_relaxed); }
+    std::uint64_t totalNanoseconds() const { return total.load(std::memory_order_relaxed); }
+    std::uint64_t maxNanoseconds() const { return maximum.load(std::memory_order_relaxed); }
+
+    void reset();
+
+private:
+    std::array<std::atomic<std::uint64_t>, kBucketCount> counts{};
+    std::atomic<std::uint64_t> total{0};
+    std::atomic<std::uint64_t> maximum{0};
+};
+
+// Per-stage statistics merged over every thread
+struct StageStats {
+    Stage stage;
+    std::uint64_t count;
+    double meanNanoseconds;
+    std::uint64_t p50Nanoseconds;
+    std::uint64_t p99Nanoseconds;
+    std::uint64_t p999Nanoseconds;
+    std::uint64_t maxNanoseconds;
+    double perSecond; // Completed calls per second of wall time since the last reset
+};
+
+class Instrumentation {
+public:
+    // True when the FACTORISATION_* macros were compiled in
+    static constexpr bool enabled() {
+#ifdef FACTORISATION_INSTRUMENTATION
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    // Record one timing for the calling thread
+    static void record(Stage stage, std::uint64_t nanoseconds);
+
+    // Statistics of every stage that recorded at least one timing
+    static std::vector<StageStats> snapshot();
+
+    // snapshot() as a table: count, mean, p50, p99, p999, max and throughput per stage
+    static std::string dump();
+
+    // Clear every histogram and restart the throughput clock. Timings recorded while this
+    // runs may be lost, so call it when instrumented code is idle.
+    static void reset();
+};
+
+// Records the time from construction to destruction under one stage
+class ScopedStageTimer {
+public:
+    explicit ScopedStageTimer(Stage stage) : stage(stage), start(std::chrono::steady_clock::now()) {}
+    ~ScopedStageTimer() {
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        Instrumentation::record(stage, static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+    }
+
+    ScopedStageTimer(const ScopedStageTimer&) = delete;
+    ScopedStageTimer& operator=(const ScopedStageTimer&) = delete;
+
+private:
+    Stage stage;
+    std::chrono::steady_clock::time_point start;
+};
+
+// Times consecutive phases: each lap records the time since the previous lap (or construction)
+class PhaseTimer {
+public:
+    PhaseTimer() : last(std::chrono::steady_clock::now()) {}
+
+    void lap(Stage stage) {
+        auto now = std::chrono::steady_clock::now();
+        Instrumentation::record(stage, static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now - last).count()));
+        last = now;
+    }
+
+private:
+    std::chrono::steady_clock::time_point last;
+};
+
+#ifdef FACTORISATION_INSTRUMENTATION
+#define FACTORISATION_TIME_SCOPE(name, stage) ScopedStageTimer name(stage)
+#define FACTORISATION_PHASES(name) PhaseTimer name
+#define FACTORISATION_PHASE(name, stage) name.lap(stage)
+#else
+#define FACTORISATION_TIME_SCOPE(name, stage) static_cast<void>(0)
+#define FACTORISATION_PHASES(name) static_cast<void>(0)
+#define FACTORISATION_PHASE(name, stage) static_cast<void>(0)
+#endif
+
+#endif // INSTRUMENTATION_H
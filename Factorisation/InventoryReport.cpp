@@ -1,22 +1,42 @@
 #include "InventoryReport.h"
+#include "Instrumentation.h"
+#include "ShardedRender.h"
 #include <sstream>
 
-InventoryReport::InventoryReport(const ProductManager& productManager) : productManager(productManager) {}
+InventoryReport::InventoryReport(const ProductManager& productManager, ThreadPool* pool, std::size_t shardSize)
+    : productManager(productManager), pool(pool), shardSize(shardSize) {}
+
+void InventoryReport::setSalePrices(const PriceTable* prices) {
+    salePrices = prices;
+}
 
 std::string InventoryReport::generate() const {
+    FACTORISATION_TIME_SCOPE(reportTimer, Stage::InventoryReport);
     std::ostringstream oss;
     oss << "Inventory Report:\n";
     // Logic to generate inventory report using productManager data
-    const std::vector<Product*>& products = productManager.getAllProducts();
+    ProductCatalog::IdOrderView products = productManager.productsInIdOrder(); // Read in place, not copied
 
     if (products.empty()) {
         oss << "No products in inventory.\n";
     } else {
-        for (const auto& product : products) {
-            oss << "- Product: " << product->getName()
-                << ", Price: $" << product->getPrice()
-                << ", Quantity: " << product->getQuantity() << "\n";
-        }
+        // Each shard of products is rendered into its own buffer; shards are joined in ID order
+        oss << renderInShards(pool, products.size(), shardSize, [this, products](std::size_t begin, std::size_t end) {
+            std::ostringstream shard;
+            for (std::size_t i = begin; i < end; ++i) {
+                const Product* product = products[i];
+                shard << "- Product: " << product->getName()
+                      << ", Price: $" << product->getPrice()
+                      << ", Quantity: " << product->getQuantity();
+                if (salePrices != nullptr) {
+                    if (std::optional<double> salePrice = salePrices->find(product->getProductId())) {
+                        shard << ", Sale Price: $" << *salePrice;
+                    }
+                }
+                shard << "\n";
+            }
+            return shard.str();
+        });
     }
 
     return oss.str();
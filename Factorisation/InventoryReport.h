@@ -4,16 +4,26 @@
 
 #include "Report.h"
 #include "ProductManager.h"
+#include "ThreadPool.h"
+#include <cstddef>
 
 class InventoryReport : public Report {
 public:
-    InventoryReport(const ProductManager& productManager);
+    // With a thread pool, products are rendered in shards of shardSize in parallel;
+    // the text is identical either way
+    InventoryReport(const ProductManager& productManager, ThreadPool* pool = nullptr, std::size_t shardSize = 16384);
     std::string generate() const override;
 
+    // Also list each product's sale price from a bulk-computed table (nullptr to omit)
+    void setSalePrices(const PriceTable* prices);
+
 private:
     const ProductManager& productManager;
+    ThreadPool* pool;
+    std::size_t shardSize;
+    const PriceTable* salePrices = nullptr;
 };
 
 #endif // INVENTORY_REPORT_H
 
-    
\ No newline at end of file
+    
\ No newline at end of file
@@ -1,33 +1,136 @@
 
 
 #include "InventoryUI.h"
+#include <algorithm> // For std::min
+#include <string>
+#include <string_view>
+#include "FormatUtils.h"
 
-// Display inventory
-void InventoryUI::displayInventory(const std::vector<Product*>& products) {
+namespace {
+
+constexpr std::string_view kClosingLine = "--------------------------\n";
+constexpr std::size_t kLongestRow = 512; // Headroom so a typical row never grows the buffer
+
+// Formats inventory rows into one reused buffer and hands it to the stream in large blocks
+class RowWriter {
+public:
+    RowWriter(std::ostream& out, std::size_t blockBytes) : out(out), blockBytes(blockBytes) {
+        buffer.reserve(blockBytes + kLongestRow);
+    }
+
+    ~RowWriter() {
+        flush();
+    }
+
+    RowWriter(const RowWriter&) = delete;
+    RowWriter& operator=(const RowWriter&) = delete;
+
+    // Same text as "Product ID: " << id << ", Name: " ... with std::fixed << std::setprecision(2)
+    void appendRow(const Product& product) {
+        buffer += "Product ID: ";
+        appendInteger(buffer, product.getProductId());
+        buffer += ", Name: ";
+        buffer += product.getName();
+        buffer += ", Category: ";
+        const Category* category = product.getCategory();
+        buffer += category != nullptr && !category->getName().empty() ? category->getName() : std::string_view("None");
+        buffer += ", Price: $";
+        appendFixed2(buffer, product.getPrice());
+        buffer += ", Quantity: ";
+        appendInteger(buffer, product.getQuantity());
+        buffer += '\n';
+        ++rows;
+        if (buffer.size() >= blockBytes) {
+            flush();
+        }
+    }
+
+    void appendText(std::string_view text) {
+        buffer += text;
+    }
+
+    void flush() {
+        if (!buffer.empty()) {
+            out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            buffer.clear();
+        }
+    }
+
+    std::size_t rowCount() const {
+        return rows;
+    }
+
+private:
+    std::ostream& out;
+    std::size_t blockBytes;
+    std::string buffer;
+    std::size_t rows = 0;
+};
+
+// The listing used to be written with std::fixed << std::setprecision(2) on the stream itself,
+// which later output to the same stream relies on, so leave it in that state after any row
+void keepStreamFormat(std::ostream& out, std::size_t rows) {
+    if (rows > 0) {
+        out << std::fixed << std::setprecision(2);
+    }
+}
+
+// Shared by both displayInventory overloads: any range of Product*
+template <typename Products>
+void displayProducts(const Products& products) {
     if (products.empty()) {
         std::cout << "Inventory is empty.\n";
         return; // Add a return here to exit early if the inventory is empty
     }
 
-    for (const auto& product : products) {
-        if (product == nullptr) {
-            std::cerr << "Error: Null product found in inventory.\n";
-            continue; // Skip to the next product if a null pointer is found
+    std::size_t rows = 0;
+    {
+        RowWriter writer(std::cout, 1 << 16);
+        for (const Product* product : products) {
+            if (product == nullptr) {
+                writer.flush(); // Keep the error in place relative to the rows before it
+                std::cerr << "Error: Null product found in inventory.\n";
+                continue; // Skip to the next product if a null pointer is found
+            }
+            writer.appendRow(*product);
         }
+        writer.appendText(kClosingLine);
+        rows = writer.rowCount();
+    }
+    keepStreamFormat(std::cout, rows);
+}
 
-        std::cout << "Product ID: " << product->getProductId()
-                  << ", Name: " << product->getName()
-                  << ", Category: ";
+} // namespace
 
-        if (product->getCategory() && !product->getCategory()->getName().empty()) {
-            std::cout << product->getCategory()->getName();
-        } else {
-            std::cout << "None";
-        }
+// Display inventory
+void InventoryUI::displayInventory(const std::vector<Product*>& products) {
+    displayProducts(products);
+}
+
+void InventoryUI::displayInventory(ProductCatalog::IdOrderView products) {
+    displayProducts(products);
+}
 
-        std::cout << ", Price: $" << std::fixed << std::setprecision(2) << product->getPrice()
-                  << ", Quantity: " << product->getQuantity() << "\n";
+// Stream one page (or all) of the inventory
+std::size_t InventoryUI::streamInventory(const ProductManager& productManager, std::ostream& out,
+                                         std::size_t offset, std::size_t limit, std::size_t bufferBytes) {
+    ProductCatalog::IdOrderView products = productManager.productsInIdOrder();
+    if (products.empty()) {
+        out << "Inventory is empty.\n";
+        return 0;
     }
 
-    std::cout << "--------------------------\n";
+    std::size_t begin = std::min(offset, products.size());
+    std::size_t end = begin + std::min(limit, products.size() - begin);
+    std::size_t rows = 0;
+    {
+        RowWriter writer(out, bufferBytes);
+        for (std::size_t i = begin; i < end; ++i) {
+            writer.appendRow(*products[i]);
+        }
+        writer.appendText(kClosingLine);
+        rows = writer.rowCount();
+    }
+    keepStreamFormat(out, rows);
+    return rows;
 }
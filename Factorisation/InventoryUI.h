@@ -4,13 +4,30 @@
 #define INVENTORY_UI_H
 
 #include "Product.h"
+#include "ProductCatalog.h"
+#include "ProductManager.h"
+#include <cstddef>
+#include <limits>
+#include <ostream>
 #include <vector>
 #include <iostream>
 #include <iomanip>
 
 class InventoryUI {
 public:
+    static constexpr std::size_t kNoLimit = std::numeric_limits<std::size_t>::max();
+
     static void displayInventory(const std::vector<Product*>& products);
+    static void displayInventory(ProductCatalog::IdOrderView products); // Straight from the catalog, no copy
+
+    // Write the inventory listing in product ID order to out: up to limit products starting at
+    // the offset-th, then the closing line. Products are read in place from the store and rows
+    // are formatted into one reused buffer that is written out in blocks of about bufferBytes,
+    // so memory stays constant however many rows are written. With the defaults the text is
+    // identical to displayInventory. Returns the number of product rows written.
+    static std::size_t streamInventory(const ProductManager& productManager, std::ostream& out,
+                                       std::size_t offset = 0, std::size_t limit = kNoLimit,
+                                       std::size_t bufferBytes = 1 << 20);
 };
 
 #endif // INVENTORY_UI_H
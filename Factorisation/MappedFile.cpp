@@ -0,0 +1,125 @@
+
+
+#include "MappedFile.h"
+#include <stdexcept>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+std::runtime_error systemError(const std::string& what, const std::string& path) {
+    return std::runtime_error(what + " " + path + ": " + std::strerror(errno));
+}
+
+} // namespace
+
+MappedFile::MappedFile(const std::string& path, Mode mode) : path(path), mode(mode) {
+    fd = mode == Mode::ReadOnly ? ::open(path.c_str(), O_RDONLY) : ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (fd < 0) {
+        throw systemError("Cannot open", path);
+    }
+    struct stat info;
+    if (::fstat(fd, &info) != 0) {
+        ::close(fd);
+        throw systemError("Cannot stat", path);
+    }
+    length = static_cast<std::size_t>(info.st_size);
+    try {
+        map();
+    } catch (...) {
+        ::close(fd);
+        throw;
+    }
+}
+
+MappedFile::~MappedFile() {
+    unmap();
+    ::close(fd);
+}
+
+char* MappedFile::data() {
+    return mapping;
+}
+
+const char* MappedFile::data() const {
+    return mapping;
+}
+
+std::size_t MappedFile::size() const {
+    return length;
+}
+
+// Grow or shrink the file and remap it
+void MappedFile::resize(std::size_t newSize) {
+    if (mode == Mode::ReadOnly) {
+        throw std::logic_error("Cannot resize read-only mapping of " + path);
+    }
+    unmap();
+    if (::ftruncate(fd, static_cast<off_t>(newSize)) != 0) {
+        throw systemError("Cannot resize", path);
+    }
+    length = newSize;
+    map();
+}
+
+// Block until the given byte range is on disk
+void MappedFile::sync(std::size_t offset, std::size_t bytes) {
+    if (mapping == nullptr || bytes == 0) {
+        return;
+    }
+    const std::size_t page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    std::size_t start = offset / page * page; // msync needs a page-aligned address
+    if (::msync(mapping + start, offset + bytes - start, MS_SYNC) != 0) {
+        throw systemError("Cannot sync", path);
+    }
+}
+
+void MappedFile::map() {
+    if (length == 0) {
+        mapping = nullptr; // Empty files cannot be mapped
+        return;
+    }
+    int protection = mode == Mode::ReadOnly ? PROT_READ : PROT_READ | PROT_WRITE;
+    void* address = ::mmap(nullptr, length, protection, MAP_SHARED, fd, 0);
+    if (address == MAP_FAILED) {
+        throw systemError("Cannot map", path);
+    }
+    mapping = static_cast<char*>(address);
+}
+
+void MappedFile::unmap() {
+    if (mapping != nullptr) {
+        ::munmap(mapping, length);
+        mapping = nullptr;
+    }
+}
+
+#else
+
+MappedFile::MappedFile(const std::string& path, Mode mode) : path(path), mode(mode) {
+    throw std::runtime_error("Memory-mapped files are not supported on this platform: " + path);
+}
+
+MappedFile::~MappedFile() = default;
+
+char* MappedFile::data() { return mapping; }
+
+const char* MappedFile::data() const { return mapping; }
+
+std::size_t MappedFile::size() const { return length; }
+
+void MappedFile::resize(std::size_t) {}
+
+void MappedFile::sync(std::size_t, std::size_t) {}
+
+void MappedFile::map() {}
+
+void MappedFile::unmap() {}
+
+#endif
@@ -0,0 +1,42 @@
+
+
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <cstddef>
+#include <string>
+
+// A file mapped into memory (POSIX mmap). Read-write mappings create the file if needed
+// and can be resized; changes reach the disk when the kernel writes them back or on sync().
+class MappedFile {
+public:
+    enum class Mode { ReadOnly, ReadWrite };
+
+    MappedFile(const std::string& path, Mode mode);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    char* data();
+    const char* data() const;
+    std::size_t size() const;
+
+    // Grow or shrink the file and remap it; pointers into the old mapping become invalid
+    void resize(std::size_t newSize);
+
+    // Block until the given byte range is on disk
+    void sync(std::size_t offset, std::size_t length);
+
+private:
+    std::string path;
+    Mode mode;
+    int fd = -1;
+    char* mapping = nullptr;
+    std::size_t length = 0;
+
+    void map();
+    void unmap();
+};
+
+#endif // MAPPED_FILE_H
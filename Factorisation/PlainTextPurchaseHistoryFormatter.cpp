@@ -2,7 +2,7 @@
 #include <sstream>
 #include <iomanip> // Add this include
 
-std::string PlainTextPurchaseHistoryFormatter::formatHistory(const std::vector<PurchaseHistory::Purchase>& history) const {
+std::string PlainTextPurchaseHistoryFormatter::formatHistory(PurchaseHistory::View history) const {
     std::ostringstream oss;
     if (history.empty()) {
         oss << "No purchase history found.\n";
@@ -5,7 +5,7 @@
 
 class PlainTextPurchaseHistoryFormatter : public PurchaseHistoryFormatter {
 public:
-    std::string formatHistory(const std::vector<PurchaseHistory::Purchase>& history) const override;
+    std::string formatHistory(PurchaseHistory::View history) const override;
 };
 
 #endif // PLAIN_TEXT_PURCHASE_HISTORY_FORMATTER_H
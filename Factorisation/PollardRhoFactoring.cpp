@@ -0,0 +1,24 @@
+
+
+#include "PollardRhoFactoring.h"
+#include "FactorKernels.h"
+#include "FactorizationBatch.h"
+
+// PollardRhoFactoring Class: Factors large numbers by finding divisors with a random walk
+// Adheres to LSP: Usable anywhere a FactoringMethod is expected.
+
+std::vector<std::uint64_t> PollardRhoFactoring::factorize(std::uint64_t number) const {
+    std::vector<std::uint64_t> factors;
+    appendFactors(number, factors);
+    return factors;
+}
+
+void PollardRhoFactoring::factorizeBatch(std::span<const std::uint64_t> numbers, FactorizationBatch& out, ThreadPool* pool) const {
+    factorizeInParallel(numbers, out, pool, [this](std::uint64_t number, std::vector<std::uint64_t>& factors) {
+        appendFactors(number, factors);
+    });
+}
+
+void PollardRhoFactoring::appendFactors(std::uint64_t number, std::vector<std::uint64_t>& factors) const {
+    pollardRhoFactors(number, factors);
+}
@@ -0,0 +1,21 @@
+
+
+#ifndef POLLARD_RHO_FACTORING_H
+#define POLLARD_RHO_FACTORING_H
+
+#include "FactoringMethod.h"
+
+// Pollard's rho (Brent's variant) with a deterministic Miller-Rabin primality test, after
+// dividing out primes below 64. Its cost grows with the fourth root of the second-largest
+// prime factor, so it handles 64-bit semiprimes that trial division cannot.
+class PollardRhoFactoring : public FactoringMethod {
+public:
+    using FactoringMethod::factorize;
+    std::vector<std::uint64_t> factorize(std::uint64_t number) const override;
+    void factorizeBatch(std::span<const std::uint64_t> numbers, FactorizationBatch& out, ThreadPool* pool = nullptr) const override;
+
+    // Append the factors of number to factors (non-virtual; used by the batch API)
+    void appendFactors(std::uint64_t number, std::vector<std::uint64_t>& factors) const;
+};
+
+#endif // POLLARD_RHO_FACTORING_H
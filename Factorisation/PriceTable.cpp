@@ -0,0 +1,39 @@
+
+
+#include "PriceTable.h"
+#include <algorithm> // For std::lower_bound
+#include <utility>
+
+PriceTable::PriceTable(std::vector<int> productIds, std::vector<double> prices)
+    : productIds(std::move(productIds)), prices(std::move(prices)) {}
+
+// Price for a product
+std::optional<double> PriceTable::find(int product_id) const {
+    if (productIds.empty()) {
+        return std::nullopt;
+    }
+    // Catalog IDs are usually assigned consecutively, so try the position the ID would have
+    // in a gap-free table before searching
+    long long guess = static_cast<long long>(product_id) - productIds.front();
+    if (guess >= 0 && guess < static_cast<long long>(productIds.size()) &&
+        productIds[static_cast<std::size_t>(guess)] == product_id) {
+        return prices[static_cast<std::size_t>(guess)];
+    }
+    auto it = std::lower_bound(productIds.begin(), productIds.end(), product_id);
+    if (it == productIds.end() || *it != product_id) {
+        return std::nullopt;
+    }
+    return prices[static_cast<std::size_t>(it - productIds.begin())];
+}
+
+std::size_t PriceTable::size() const {
+    return productIds.size();
+}
+
+const std::vector<int>& PriceTable::getProductIds() const {
+    return productIds;
+}
+
+const std::vector<double>& PriceTable::getPrices() const {
+    return prices;
+}
@@ -0,0 +1,29 @@
+
+
+#ifndef PRICE_TABLE_H
+#define PRICE_TABLE_H
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+// Discounted prices for a set of products, held as two parallel arrays sorted by product ID.
+// Produced in bulk by ProductManager::repriceAll / repriceCategory.
+class PriceTable {
+public:
+    PriceTable() = default;
+    PriceTable(std::vector<int> productIds, std::vector<double> prices);
+
+    // Price for a product, or no value if it is not in the table
+    std::optional<double> find(int product_id) const;
+
+    std::size_t size() const;
+    const std::vector<int>& getProductIds() const;
+    const std::vector<double>& getPrices() const;
+
+private:
+    std::vector<int> productIds; // Ascending
+    std::vector<double> prices;  // prices[i] belongs to productIds[i]
+};
+
+#endif // PRICE_TABLE_H
@@ -2,6 +2,7 @@
 
 #include "Product.h"
 #include <stdexcept>
+#include <utility>
 
 // Product Class: Manages product properties
 // Adheres to SRP: Handles only the properties and state of a single product.
@@ -10,15 +11,42 @@
 // changing existing logic.
 
 // Constructor
-Product::Product(int id, const std::string& name, double price, int quantity, Category* category)
+Product::Product(int id, std::string_view name, double price, int quantity, Category* category)
     : product_id(id), product_name(name), product_price(price), product_quantity(quantity), category(category) {}
 
+// Copying snapshots the current stock level
+Product::Product(const Product& other)
+    : product_id(other.product_id), product_name(other.product_name), product_price(other.product_price),
+      product_quantity(other.getQuantity()), category(other.category) {}
+
+Product::Product(Product&& other) noexcept
+    : product_id(other.product_id), product_name(std::move(other.product_name)), product_price(other.product_price),
+      product_quantity(other.getQuantity()), category(other.category) {}
+
+Product& Product::operator=(const Product& other) {
+    product_id = other.product_id;
+    product_name = other.product_name;
+    product_price = other.product_price;
+    product_quantity.store(other.getQuantity(), std::memory_order_relaxed);
+    category = other.category;
+    return *this;
+}
+
+Product& Product::operator=(Product&& other) noexcept {
+    product_id = other.product_id;
+    product_name = std::move(other.product_name);
+    product_price = other.product_price;
+    product_quantity.store(other.getQuantity(), std::memory_order_relaxed);
+    category = other.category;
+    return *this;
+}
+
 // Getters
 int Product::getProductId() const { 
     return product_id; 
 }
 
-std::string Product::getName() const { 
+std::string_view Product::getName() const { 
     return product_name; 
 }
 
@@ -27,7 +55,7 @@ double Product::getPrice() const {
 }
 
 int Product::getQuantity() const { 
-    return product_quantity; 
+    return product_quantity.load(std::memory_order_acquire); 
 }
 
 Category* Product::getCategory() const { 
@@ -50,8 +78,25 @@ void Product::updatePrice(double newPrice) {
 
 void Product::updateQuantity(int newQuantity) {
     if (newQuantity >= 0) {
-        product_quantity = newQuantity;
+        product_quantity.store(newQuantity, std::memory_order_release);
     } else {
         throw std::invalid_argument("Invalid quantity.");
     }
 }
+
+// Reserve stock with a single compare-and-swap decrement, retried only if another thread
+// changed the quantity in between; this is what prevents overselling under concurrency
+bool Product::tryReserve(int quantity) {
+    int available = product_quantity.load(std::memory_order_acquire);
+    while (available >= quantity) {
+        if (product_quantity.compare_exchange_weak(available, available - quantity,
+                                                   std::memory_order_acq_rel, std::memory_order_acquire)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void Product::release(int quantity) {
+    product_quantity.fetch_add(quantity, std::memory_order_acq_rel);
+}
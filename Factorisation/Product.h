@@ -3,7 +3,9 @@
 #ifndef PRODUCT_H
 #define PRODUCT_H
 
+#include <atomic>
 #include <string>
+#include <string_view>
 #include "Category.h" // Include Category for association
 
 class Product {
@@ -11,26 +13,39 @@ private:
     int product_id;
     std::string product_name;
     double product_price;
-    int product_quantity;
+    std::atomic<int> product_quantity; // Updated atomically so checkout can run on many threads
     Category* category; // Associated category
 
+    // Only ProductCatalog may move a product between categories, so its category index stays
+    // the single path for the change
+    friend class ProductCatalog;
+    void setCategory(Category* newCategory);
+
 public:
     // Constructor
-    Product(int id, const std::string& name, double price, int quantity, Category* category = nullptr);
+    Product(int id, std::string_view name, double price, int quantity, Category* category = nullptr);
+    Product(const Product& other);
+    Product(Product&& other) noexcept;
+    Product& operator=(const Product& other);
+    Product& operator=(Product&& other) noexcept;
 
     // Getters
     int getProductId() const;
-    std::string getName() const;
+    std::string_view getName() const; // Valid until the product is moved or destroyed
     double getPrice() const;
     int getQuantity() const;
     Category* getCategory() const;
 
-    // Setters
-    void setCategory(Category* newCategory);
-
     // Updates
     void updatePrice(double newPrice);
     void updateQuantity(int newQuantity);
+
+    // Atomically take quantity units out of stock; returns false (leaving stock untouched)
+    // if fewer than quantity units are available
+    bool tryReserve(int quantity);
+
+    // Atomically return previously reserved units to stock
+    void release(int quantity);
 };
 
 #endif // PRODUCT_H
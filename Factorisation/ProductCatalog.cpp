@@ -0,0 +1,135 @@
+
+
+#include "ProductCatalog.h"
+#include <algorithm> // For std::lower_bound
+#include <stdexcept>
+#include <utility>
+
+// ProductCatalog Class: Owns product storage for ProductManager
+// Adheres to SRP: Only concerned with where products live and how they are found by ID.
+
+// Store a product
+ProductCatalog::Entry& ProductCatalog::insert(Product&& product) {
+    int product_id = product.getProductId();
+    if (slotOf(product_id) != kNoSlot) {
+        throw std::invalid_argument("Product with this ID already exists.");
+    }
+
+    std::uint32_t slot = static_cast<std::uint32_t>(count);
+    if (slot / kChunkSize == chunks.size()) {
+        chunks.emplace_back();
+        chunks.back().reserve(kChunkSize);
+    }
+    std::vector<Entry>& chunk = chunks[slot / kChunkSize];
+    chunk.push_back(Entry{std::move(product), Discount(), false});
+
+    if (product_id >= 0 && product_id < kDenseIdLimit) {
+        if (static_cast<std::size_t>(product_id) >= denseIndex.size()) {
+            denseIndex.resize(static_cast<std::size_t>(product_id) + 1, kNoSlot);
+        }
+        denseIndex[product_id] = static_cast<std::int32_t>(slot);
+    } else {
+        sparseIndex.emplace(product_id, slot);
+    }
+
+    // IDs usually arrive in ascending order, which keeps this an append
+    if (idOrder.empty() || entryAt(idOrder.back()).product.getProductId() < product_id) {
+        idOrder.push_back(slot);
+    } else {
+        auto position = std::lower_bound(idOrder.begin(), idOrder.end(), product_id,
+            [this](std::uint32_t existing, int id) { return entryAt(existing).product.getProductId() < id; });
+        idOrder.insert(position, slot);
+    }
+
+    indexCategory(chunk.back().product);
+    ++count;
+    return chunk.back();
+}
+
+// Find the entry for a product ID
+ProductCatalog::Entry* ProductCatalog::find(int product_id) {
+    std::int32_t slot = slotOf(product_id);
+    return slot == kNoSlot ? nullptr : &entryAt(static_cast<std::uint32_t>(slot));
+}
+
+const ProductCatalog::Entry* ProductCatalog::find(int product_id) const {
+    std::int32_t slot = slotOf(product_id);
+    return slot == kNoSlot ? nullptr : &entryAt(static_cast<std::uint32_t>(slot));
+}
+
+// Number of stored products
+std::size_t ProductCatalog::size() const {
+    return count;
+}
+
+// Reserve index and storage space
+void ProductCatalog::reserve(std::size_t expected) {
+    chunks.reserve((expected + kChunkSize - 1) / kChunkSize);
+    idOrder.reserve(expected);
+}
+
+// Move a stored product to another category
+void ProductCatalog::setCategory(Entry& entry, Category* category) {
+    unindexCategory(entry.product);
+    entry.product.setCategory(category);
+    indexCategory(entry.product);
+}
+
+// Products in a category
+std::span<Product* const> ProductCatalog::inCategory(int category_id) const {
+    auto it = categoryIndex.find(category_id);
+    if (it == categoryIndex.end()) {
+        return {};
+    }
+    return it->second;
+}
+
+namespace {
+
+bool lowerProductId(const Product* product, int id) {
+    return product->getProductId() < id;
+}
+
+} // namespace
+
+// Add a product to its category's list
+void ProductCatalog::indexCategory(Product& product) {
+    if (product.getCategory() == nullptr) {
+        return;
+    }
+    std::vector<Product*>& members = categoryIndex[product.getCategory()->getCategoryId()];
+    int product_id = product.getProductId();
+    if (members.empty() || members.back()->getProductId() < product_id) {
+        members.push_back(&product);
+    } else {
+        members.insert(std::lower_bound(members.begin(), members.end(), product_id, lowerProductId), &product);
+    }
+}
+
+// Remove a product from its category's list
+void ProductCatalog::unindexCategory(Product& product) {
+    if (product.getCategory() == nullptr) {
+        return;
+    }
+    auto it = categoryIndex.find(product.getCategory()->getCategoryId());
+    if (it == categoryIndex.end()) {
+        return;
+    }
+    std::vector<Product*>& members = it->second;
+    auto position = std::lower_bound(members.begin(), members.end(), product.getProductId(), lowerProductId);
+    if (position != members.end() && *position == &product) {
+        members.erase(position);
+    }
+    if (members.empty()) {
+        categoryIndex.erase(it);
+    }
+}
+
+// Map a product ID to its storage slot
+std::int32_t ProductCatalog::slotOf(int product_id) const {
+    if (product_id >= 0 && product_id < kDenseIdLimit) {
+        return static_cast<std::size_t>(product_id) < denseIndex.size() ? denseIndex[product_id] : kNoSlot;
+    }
+    auto it = sparseIndex.find(product_id);
+    return it == sparseIndex.end() ? kNoSlot : static_cast<std::int32_t>(it->second);
+}
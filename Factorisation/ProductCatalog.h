@@ -0,0 +1,134 @@
+
+
+#ifndef PRODUCT_CATALOG_H
+#define PRODUCT_CATALOG_H
+
+#include <cstddef>
+#include <compare>
+#include <cstdint>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <unordered_map>
+#include <vector>
+#include "Product.h"
+#include "Discount.h"
+
+// Contiguous storage for the product catalog.
+// Products are stored by value in fixed-size chunks (so their addresses never change),
+// each one next to its discount, and found through a dense product ID -> slot index.
+// A category ID -> products index is kept up to date; setCategory() is the only way to change a
+// stored product's category (Product::setCategory is private to this class).
+// The ID order and each category's list are sorted vectors. Inserting in ascending ID order,
+// as the importers and snapshot loader do, only appends; an out-of-order insert or a category
+// change shifts the tail of the vector, costing O(n) in the list's size. They are kept sorted
+// eagerly rather than sorted on first read so that const readers never write.
+class ProductCatalog {
+public:
+    struct Entry {
+        Product product;
+        Discount discount;
+        bool hasDiscount;
+    };
+
+    // Store a product; throws if a product with the same ID already exists
+    Entry& insert(Product&& product);
+
+    // Find the entry for a product ID, or nullptr if there is none
+    Entry* find(int product_id);
+    const Entry* find(int product_id) const;
+
+    // Number of stored products
+    std::size_t size() const;
+
+    // Reserve index and storage space for the given number of products
+    void reserve(std::size_t count);
+
+    // Move a stored product to another category (nullptr for none), updating the index
+    void setCategory(Entry& entry, Category* category);
+
+    // Products in a category, in ascending product ID order (empty if there are none).
+    // The span is invalidated by the next insert or setCategory.
+    std::span<Product* const> inCategory(int category_id) const;
+
+    // Every product in ascending ID order, read straight from the catalog. It is a
+    // random-access range, so std::views adaptors (filter, take, ...) work on it lazily and a
+    // loop can stop early without having touched the rest. Invalidated by the next insert.
+    class IdOrderView : public std::ranges::view_interface<IdOrderView> {
+    public:
+        class iterator {
+        public:
+            using iterator_concept = std::random_access_iterator_tag;
+            using iterator_category = std::input_iterator_tag; // Dereferencing yields a pointer by value
+            using value_type = Product*;
+            using difference_type = std::ptrdiff_t;
+
+            iterator() = default;
+            iterator(const ProductCatalog* catalog, const std::uint32_t* slot) : catalog(catalog), slot(slot) {}
+
+            // Callers may update stock, as with ProductManager::getAllProducts
+            Product* operator*() const { return const_cast<Product*>(&catalog->entryAt(*slot).product); }
+            Product* operator[](difference_type offset) const { return *(*this + offset); }
+
+            iterator& operator++() { ++slot; return *this; }
+            iterator operator++(int) { iterator previous = *this; ++slot; return previous; }
+            iterator& operator--() { --slot; return *this; }
+            iterator operator--(int) { iterator previous = *this; --slot; return previous; }
+            iterator& operator+=(difference_type offset) { slot += offset; return *this; }
+            iterator& operator-=(difference_type offset) { slot -= offset; return *this; }
+            friend iterator operator+(iterator it, difference_type offset) { return it += offset; }
+            friend iterator operator+(difference_type offset, iterator it) { return it += offset; }
+            friend iterator operator-(iterator it, difference_type offset) { return it -= offset; }
+            friend difference_type operator-(const iterator& a, const iterator& b) { return a.slot - b.slot; }
+            bool operator==(const iterator& other) const { return slot == other.slot; }
+            std::strong_ordering operator<=>(const iterator& other) const { return slot <=> other.slot; }
+
+        private:
+            const ProductCatalog* catalog = nullptr;
+            const std::uint32_t* slot = nullptr;
+        };
+
+        IdOrderView() = default;
+        explicit IdOrderView(const ProductCatalog& catalog) : catalog(&catalog) {}
+
+        iterator begin() const { return catalog == nullptr ? iterator() : iterator(catalog, catalog->idOrder.data()); }
+        iterator end() const { return catalog == nullptr ? iterator() : iterator(catalog, catalog->idOrder.data() + catalog->idOrder.size()); }
+        std::size_t size() const { return catalog == nullptr ? 0 : catalog->idOrder.size(); }
+
+    private:
+        const ProductCatalog* catalog = nullptr;
+    };
+
+    IdOrderView inIdOrder() const { return IdOrderView(*this); }
+
+    // Visit every entry in ascending product ID order
+    template <typename Visitor>
+    void forEachInIdOrder(Visitor&& visit) const {
+        for (std::uint32_t slot : idOrder) {
+            visit(entryAt(slot));
+        }
+    }
+
+private:
+    static constexpr std::size_t kChunkSize = 4096;       // Entries per storage chunk
+    static constexpr int kDenseIdLimit = 1 << 24;         // IDs below this use the dense index
+    static constexpr std::int32_t kNoSlot = -1;
+
+    std::vector<std::vector<Entry>> chunks;               // Entry storage, never reallocated once full
+    std::vector<std::int32_t> denseIndex;                 // Product ID -> slot for IDs in [0, kDenseIdLimit)
+    std::unordered_map<int, std::uint32_t> sparseIndex;   // Product ID -> slot for all other IDs
+    std::vector<std::uint32_t> idOrder;                   // Slots sorted by product ID
+    std::unordered_map<int, std::vector<Product*>> categoryIndex; // Category ID -> products sorted by ID
+    std::size_t count = 0;
+
+    std::int32_t slotOf(int product_id) const;
+    void indexCategory(Product& product);
+    void unindexCategory(Product& product);
+    Entry& entryAt(std::uint32_t slot) { return chunks[slot / kChunkSize][slot % kChunkSize]; }
+    const Entry& entryAt(std::uint32_t slot) const { return chunks[slot / kChunkSize][slot % kChunkSize]; }
+};
+
+static_assert(std::ranges::random_access_range<ProductCatalog::IdOrderView>);
+static_assert(std::ranges::view<ProductCatalog::IdOrderView>);
+
+#endif // PRODUCT_CATALOG_H
@@ -1,77 +1,238 @@
 
 
 #include "ProductManager.h"
+#include "Repricing.h"
+#include <algorithm> // For std::min, std::sort
+#include <limits>
 #include <stdexcept>
-#include <algorithm> // For std::find
+#include <string>
+#include <utility>
 
 // ProductManager Class: Handles product operations
 // Adheres to SRP: Focuses only on managing a collection of products (add, update, fetch).
+// Storage itself is delegated to ProductCatalog, which keeps products and their discounts contiguous.
 // Adheres to OCP: Discount management extended keeping core product functionality unchanged. Now applies discounts dynamically without modifying original product and price logic
 // Adheres to OCP: Also extended by filtering by category to allow further functionality to be added without modifying existing methods.
 
 // Add a product to the manager
 void ProductManager::addProduct(Product* product) {
-    if (products.find(product->getProductId()) != products.end()) {
-        throw std::invalid_argument("Product with this ID already exists.");
+    catalog.insert(std::move(*product));
+    delete product; // The catalog now holds the product by value
+}
+
+void ProductManager::addProduct(Product product) {
+    catalog.insert(std::move(product));
+}
+
+// Construct a product in the catalog
+Product* ProductManager::emplaceProduct(int product_id, std::string_view name, double price, int quantity, Category* category) {
+    return &catalog.insert(Product(product_id, name, price, quantity, category)).product;
+}
+
+// Create a category owned by the manager
+Category* ProductManager::createCategory(int category_id, std::string_view name) {
+    auto [it, inserted] = categories.try_emplace(category_id, nullptr);
+    if (!inserted) {
+        throw std::invalid_argument("Category with this ID already exists.");
+    }
+    try {
+        it->second = categoryStorage.create(category_id, name);
+    } catch (...) {
+        categories.erase(it);
+        throw;
+    }
+    return it->second;
+}
+
+// Find a category created through createCategory
+Category* ProductManager::findCategory(int category_id) const noexcept {
+    auto it = categories.find(category_id);
+    return it == categories.end() ? nullptr : it->second;
+}
+
+// Categories created through createCategory
+std::vector<Category*> ProductManager::getAllCategories() const {
+    std::vector<Category*> categoryList;
+    categoryList.reserve(categories.size());
+    for (const auto& pair : categories) {
+        categoryList.push_back(pair.second);
     }
-    products[product->getProductId()] = product;
+    std::sort(categoryList.begin(), categoryList.end(), [](const Category* a, const Category* b) {
+        return a->getCategoryId() < b->getCategoryId();
+    });
+    return categoryList;
+}
+
+// Reserve space for a bulk load of products
+void ProductManager::reserve(std::size_t productCount) {
+    catalog.reserve(productCount);
 }
 
 // Retrieve a product by ID
 Product* ProductManager::getProduct(int product_id) {
-    auto it = products.find(product_id);
-    if (it == products.end()) {
+    Product* product = findProduct(product_id);
+    if (product == nullptr) {
         throw std::invalid_argument("Product not found with ID: " + std::to_string(product_id));
     }
-    return it->second;
+    return product;
+}
+
+// Retrieve a product by ID without throwing
+Product* ProductManager::findProduct(int product_id) noexcept {
+    ProductCatalog::Entry* entry = catalog.find(product_id);
+    return entry == nullptr ? nullptr : &entry->product;
+}
+
+const Product* ProductManager::findProduct(int product_id) const noexcept {
+    const ProductCatalog::Entry* entry = catalog.find(product_id);
+    return entry == nullptr ? nullptr : &entry->product;
 }
 
 // Retrieve all products
 std::vector<Product*> ProductManager::getAllProducts() const {
     std::vector<Product*> productList;
-    for (const auto& pair : products) {
-        productList.push_back(pair.second);
-    }
+    productList.reserve(catalog.size());
+    catalog.forEachInIdOrder([&](const ProductCatalog::Entry& entry) {
+        productList.push_back(const_cast<Product*>(&entry.product)); // Callers may update stock
+    });
     return productList;
 }
 
+// Products in ID order, read in place
+ProductCatalog::IdOrderView ProductManager::productsInIdOrder() const {
+    return catalog.inIdOrder();
+}
+
 // Set a discount for a product
 void ProductManager::setDiscount(int product_id, const Discount& discount) {
-    if (products.find(product_id) == products.end()) {
+    ProductCatalog::Entry* entry = catalog.find(product_id);
+    if (entry == nullptr) {
         throw std::invalid_argument("Cannot apply discount: Product not found.");
     }
-    productDiscounts[product_id] = discount;
+    entry->discount = discount;
+    entry->hasDiscount = true;
+}
+
+// Discount set for a product
+const Discount* ProductManager::findDiscount(int product_id) const noexcept {
+    const ProductCatalog::Entry* entry = catalog.find(product_id);
+    return entry != nullptr && entry->hasDiscount ? &entry->discount : nullptr;
 }
 
 // Get the price of a product after applying its discount
 double ProductManager::getDiscountPrice(int product_id) const {
-    auto productIter = products.find(product_id);
-    if (productIter == products.end()) {
+    std::optional<double> price = findDiscountPrice(product_id);
+    if (!price) {
         throw std::invalid_argument("Product not found with ID " + std::to_string(product_id));
     }
+    return *price;
+}
+
+// Get the discounted price without throwing for unknown products
+std::optional<double> ProductManager::findDiscountPrice(int product_id) const {
+    const ProductCatalog::Entry* entry = catalog.find(product_id);
+    if (entry == nullptr) {
+        return std::nullopt;
+    }
 
-    const Product* product = productIter->second;
-    auto discountIter = productDiscounts.find(product_id);
-    if (discountIter != productDiscounts.end()) {
-        return discountIter->second.applyDiscount(product->getPrice());
+    if (entry->hasDiscount) {
+        return entry->discount.applyDiscount(entry->product.getPrice());
     }
-    return product->getPrice(); // No discount
+    return entry->product.getPrice(); // No discount
 }
 
-// Get products by category
-std::vector<Product*> ProductManager::getProductsByCategory(int category_id) const {
-    std::vector<Product*> filteredProducts;
-    for (const auto& pair : products) {
-        if (pair.second->getCategory() && pair.second->getCategory()->getCategoryId() == category_id) {
-            filteredProducts.push_back(pair.second);
+namespace {
+
+// Gather the selected products block by block into small contiguous buffers and price each
+// block with the bulk kernel, so only the resulting table is allocated
+template <typename ForEachEntry>
+PriceTable repriceSelected(std::size_t expected, ForEachEntry forEachEntry) {
+    constexpr std::size_t kBlock = 512;
+    double prices[kBlock], multipliers[kBlock], subtrahends[kBlock], floors[kBlock];
+    std::vector<const Discount*> stacked(kBlock); // Discounts that need the general evaluation
+    std::size_t filled = 0;
+
+    std::vector<int> ids;
+    std::vector<double> discounted;
+    ids.reserve(expected);
+    discounted.reserve(expected);
+
+    auto flush = [&] {
+        std::size_t base = discounted.size();
+        discounted.resize(base + filled);
+        repriceLinear(prices, multipliers, subtrahends, floors, discounted.data() + base, filled);
+        for (std::size_t i = 0; i < filled; ++i) {
+            if (stacked[i] != nullptr) {
+                discounted[base + i] = stacked[i]->applyDiscount(prices[i]);
+            }
+        }
+        filled = 0;
+    };
+
+    forEachEntry([&](const ProductCatalog::Entry& entry) {
+        double multiplier = 1.0;
+        double subtrahend = 0.0;
+        double floor = -std::numeric_limits<double>::infinity(); // No discount: price unchanged
+        const Discount* general = nullptr;
+        if (entry.hasDiscount && !entry.discount.getLinearForm(multiplier, subtrahend, floor)) {
+            general = &entry.discount;
         }
+        ids.push_back(entry.product.getProductId());
+        prices[filled] = entry.product.getPrice();
+        multipliers[filled] = multiplier;
+        subtrahends[filled] = subtrahend;
+        floors[filled] = floor;
+        stacked[filled] = general;
+        if (++filled == kBlock) {
+            flush();
+        }
+    });
+    flush();
+    return PriceTable(std::move(ids), std::move(discounted));
+}
+
+} // namespace
+
+// Discounted prices of the whole catalog
+PriceTable ProductManager::repriceAll() const {
+    return repriceSelected(catalog.size(), [this](auto&& visit) { catalog.forEachInIdOrder(visit); });
+}
+
+// Discounted prices of one category
+PriceTable ProductManager::repriceCategory(int category_id) const {
+    std::span<Product* const> products = catalog.inCategory(category_id);
+    return repriceSelected(products.size(), [this, products](auto&& visit) {
+        for (const Product* product : products) {
+            visit(*catalog.find(product->getProductId()));
+        }
+    });
+}
+
+// Move a product to another category
+void ProductManager::setCategory(int product_id, Category* category) {
+    ProductCatalog::Entry* entry = catalog.find(product_id);
+    if (entry == nullptr) {
+        throw std::invalid_argument("Cannot set category: Product not found.");
     }
-    return filteredProducts;
+    catalog.setCategory(*entry, category);
 }
 
-// Destructor to clean up allocated memory
-ProductManager::~ProductManager() {
-    for (auto& pair : products) {
-        delete pair.second;
+// Get products by category
+std::vector<Product*> ProductManager::getProductsByCategory(int category_id) const {
+    std::span<Product* const> products = catalog.inCategory(category_id);
+    return std::vector<Product*>(products.begin(), products.end());
+}
+
+// One page of a category's products
+std::span<Product* const> ProductManager::getProductsByCategory(int category_id, std::size_t offset, std::size_t limit) const {
+    std::span<Product* const> products = catalog.inCategory(category_id);
+    if (offset >= products.size()) {
+        return {};
     }
+    return products.subspan(offset, std::min(limit, products.size() - offset));
+}
+
+// Number of products in a category
+std::size_t ProductManager::countProductsByCategory(int category_id) const {
+    return catalog.inCategory(category_id).size();
 }
@@ -3,37 +3,92 @@
 #ifndef PRODUCT_MANAGER_H
 #define PRODUCT_MANAGER_H
 
-#include <map>
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include "Arena.h"
+#include "Category.h"
 #include <vector>
 #include "Product.h"
 #include "Discount.h"
+#include "ProductCatalog.h"
+#include "PriceTable.h"
 
 class ProductManager {
 private:
-    std::map<int, Product*> products;         // Maps product IDs to products
-    std::map<int, Discount> productDiscounts; // Maps product IDs to discounts
+    ProductCatalog catalog; // Products stored by value, each alongside its discount
+    Arena<Category> categoryStorage; // Owns categories created through createCategory
+    std::unordered_map<int, Category*> categories; // Category ID -> category in categoryStorage
 
 public:
-    // Add a product to the manager
+    // Add a product to the manager (the manager takes ownership and stores it by value)
     void addProduct(Product* product);
+    void addProduct(Product product);
 
-    // Retrieve a product by ID
+    // Construct a product directly in the catalog (throws if the ID is already taken)
+    Product* emplaceProduct(int product_id, std::string_view name, double price, int quantity, Category* category = nullptr);
+
+    // Create a category owned by the manager; it lives as long as the manager
+    // (throws if the ID is already taken)
+    Category* createCategory(int category_id, std::string_view name);
+
+    // Category created through createCategory, or nullptr if there is none with this ID
+    Category* findCategory(int category_id) const noexcept;
+
+    // Categories created through createCategory, in ascending ID order
+    std::vector<Category*> getAllCategories() const;
+
+    // Reserve space for a bulk load of products
+    void reserve(std::size_t productCount);
+
+    // Retrieve a product by ID (throws std::invalid_argument if it does not exist)
     Product* getProduct(int product_id);
 
+    // Retrieve a product by ID, or nullptr if it does not exist
+    Product* findProduct(int product_id) noexcept;
+    const Product* findProduct(int product_id) const noexcept;
+
     // Retrieve all products
     std::vector<Product*> getAllProducts() const;
 
+    // All products in ascending ID order without copying them into a vector: iterate it,
+    // filter it lazily (e.g. with std::views::filter) or stop early. Invalidated by adding products.
+    ProductCatalog::IdOrderView productsInIdOrder() const;
+
     // Set a discount for a product
     void setDiscount(int product_id, const Discount& discount);
 
+    // Discount set for a product, or nullptr if it has none or does not exist
+    const Discount* findDiscount(int product_id) const noexcept;
+
     // Get the price of a product after applying its discount
     double getDiscountPrice(int product_id) const;
 
+    // Discounted price, or no value if the product does not exist
+    // (an invalid discount type still throws, as in getDiscountPrice)
+    std::optional<double> findDiscountPrice(int product_id) const;
+
+    // Discounted prices of the whole catalog, or of one category, computed in one pass
+    // over contiguous price and discount arrays with vectorised kernels
+    PriceTable repriceAll() const;
+    PriceTable repriceCategory(int category_id) const;
+
+    // Move a product to another category (nullptr for none), keeping category queries correct.
+    // Costs O(n) in the size of both categories' product lists.
+    void setCategory(int product_id, Category* category);
+
     // Get products by category
     std::vector<Product*> getProductsByCategory(int category_id) const;
 
-    // Destructor to clean up allocated memory
-    ~ProductManager();
+    // One page of a category's products in ascending ID order, without copying: up to limit
+    // products starting at offset. The span is invalidated by adding products or changing categories.
+    std::span<Product* const> getProductsByCategory(int category_id, std::size_t offset, std::size_t limit) const;
+
+    // Number of products in a category
+    std::size_t countProductsByCategory(int category_id) const;
 };
 
 #endif // PRODUCT_MANAGER_H
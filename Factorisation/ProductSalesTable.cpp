@@ -0,0 +1,91 @@
+#include "ProductSalesTable.h"
+
+// ProductSalesTable Class: Per-product names and sales totals for the purchase records
+// Adheres to SRP: Only stores and resolves per-product data; the purchase records hold product IDs.
+
+// Count a sale and record the product's name
+void ProductSalesTable::recordSale(int product_id, std::string_view name, int quantity, double total_cost) {
+    Slot& slot = slotFor(product_id);
+    StringPool::Id current = slot.name.load(std::memory_order_acquire);
+    if (current == kNoName || names.view(current) != name) {
+        slot.name.store(names.intern(name), std::memory_order_release); // New product or renamed
+    }
+    slot.purchases.fetch_add(1, std::memory_order_relaxed);
+    slot.units.fetch_add(quantity, std::memory_order_relaxed);
+    slot.revenue.fetch_add(total_cost, std::memory_order_relaxed);
+}
+
+// Name of a product
+std::string_view ProductSalesTable::nameOf(int product_id) const {
+    const Slot* slot = findSlot(product_id);
+    StringPool::Id nameId = slot == nullptr ? kNoName : slot->name.load(std::memory_order_acquire);
+    return nameId == kNoName ? std::string_view() : names.view(nameId);
+}
+
+// Totals of every product sold so far
+std::vector<ProductSalesTable::Sales> ProductSalesTable::getSales() const {
+    std::vector<Sales> sales;
+    auto collect = [&sales](int product_id, const Slot& slot) {
+        std::size_t purchases = slot.purchases.load(std::memory_order_relaxed);
+        if (purchases > 0) {
+            sales.push_back(Sales{product_id, purchases, slot.units.load(std::memory_order_relaxed),
+                                  slot.revenue.load(std::memory_order_relaxed)});
+        }
+    };
+    for (std::size_t chunk = 0; chunk < kChunkCount; ++chunk) {
+        if (const Chunk* slots = chunks[chunk].load(std::memory_order_acquire)) {
+            for (std::size_t i = 0; i < kChunkSize; ++i) {
+                collect(static_cast<int>(chunk * kChunkSize + i), (*slots)[i]);
+            }
+        }
+    }
+    std::shared_lock<std::shared_mutex> sparse(sparseLock);
+    for (const auto& [product_id, slot] : sparseSlots) {
+        collect(product_id, slot);
+    }
+    return sales;
+}
+
+// The interned names
+const StringPool& ProductSalesTable::getNames() const {
+    return names;
+}
+
+// Slot of a product, created on its first sale
+ProductSalesTable::Slot& ProductSalesTable::slotFor(int product_id) {
+    if (product_id >= 0 && static_cast<std::size_t>(product_id) < kDenseLimit) {
+        std::size_t index = static_cast<std::size_t>(product_id);
+        Chunk* chunk = chunks[index / kChunkSize].load(std::memory_order_acquire);
+        if (chunk == nullptr) {
+            std::lock_guard<std::mutex> lock(chunkLock);
+            chunk = chunks[index / kChunkSize].load(std::memory_order_relaxed); // Another thread may have added it
+            if (chunk == nullptr) {
+                chunkStorage.push_back(std::make_unique<Chunk>());
+                chunk = chunkStorage.back().get();
+                chunks[index / kChunkSize].store(chunk, std::memory_order_release);
+            }
+        }
+        return (*chunk)[index % kChunkSize];
+    }
+    {
+        std::shared_lock<std::shared_mutex> sparse(sparseLock);
+        auto it = sparseSlots.find(product_id);
+        if (it != sparseSlots.end()) {
+            return it->second;
+        }
+    }
+    std::unique_lock<std::shared_mutex> sparse(sparseLock);
+    return sparseSlots.try_emplace(product_id).first->second;
+}
+
+// Slot of a product, or nullptr if it was never sold
+const ProductSalesTable::Slot* ProductSalesTable::findSlot(int product_id) const {
+    if (product_id >= 0 && static_cast<std::size_t>(product_id) < kDenseLimit) {
+        std::size_t index = static_cast<std::size_t>(product_id);
+        const Chunk* chunk = chunks[index / kChunkSize].load(std::memory_order_acquire);
+        return chunk == nullptr ? nullptr : &(*chunk)[index % kChunkSize];
+    }
+    std::shared_lock<std::shared_mutex> sparse(sparseLock);
+    auto it = sparseSlots.find(product_id);
+    return it == sparseSlots.end() ? nullptr : &it->second;
+}
@@ -0,0 +1,72 @@
+
+
+#ifndef PRODUCT_SALES_TABLE_H
+#define PRODUCT_SALES_TABLE_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "StringPool.h"
+
+// Per-product data behind the purchase records, looked up by product ID: the display name
+// and running sales totals. Names are interned, so each distinct name is stored once however
+// many records use it, and totals are relaxed atomics, so concurrent checkouts never wait on
+// each other to count a sale.
+// Products with IDs below kDenseLimit live in fixed-size chunks reached from an atomic chunk
+// table, so recording a sale of a product seen before takes no lock. Other IDs fall back to a
+// map under a shared lock.
+class ProductSalesTable {
+public:
+    // Running totals of one product
+    struct Sales {
+        int product_id;
+        std::size_t purchases;
+        long long units;
+        double revenue;
+    };
+
+    // Count a sale and record the product's name; a new name replaces the old one for every
+    // record of the product
+    void recordSale(int product_id, std::string_view name, int quantity, double total_cost);
+
+    // Name of a product, or an empty view if it was never sold
+    std::string_view nameOf(int product_id) const;
+
+    // Totals of every product sold so far. Sales recorded concurrently may be partly included.
+    std::vector<Sales> getSales() const;
+
+    // The interned names
+    const StringPool& getNames() const;
+
+private:
+    static constexpr std::size_t kChunkSize = 4096;
+    static constexpr std::size_t kDenseLimit = std::size_t{1} << 24;
+    static constexpr std::size_t kChunkCount = kDenseLimit / kChunkSize;
+    static constexpr StringPool::Id kNoName = ~StringPool::Id{0};
+
+    struct Slot {
+        std::atomic<StringPool::Id> name{kNoName};
+        std::atomic<std::size_t> purchases{0};
+        std::atomic<long long> units{0};
+        std::atomic<double> revenue{0.0};
+    };
+    using Chunk = std::array<Slot, kChunkSize>;
+
+    StringPool names;
+    std::array<std::atomic<Chunk*>, kChunkCount> chunks{}; // Dense product IDs
+    std::vector<std::unique_ptr<Chunk>> chunkStorage;      // Owns the chunks
+    std::unordered_map<int, Slot> sparseSlots;             // Every other product ID (nodes never move)
+    mutable std::shared_mutex sparseLock;
+    std::mutex chunkLock;                                  // Serialises chunk allocation
+
+    Slot& slotFor(int product_id);
+    const Slot* findSlot(int product_id) const;
+};
+
+#endif // PRODUCT_SALES_TABLE_H
@@ -3,10 +3,10 @@
 
 Program::Program(ProductManager& pm, CustomerManager& cm, Transaction& transaction,
                  InventoryUI& inventoryUI, PurchaseHistoryFormatter& purchaseHistoryFormatter,
-                 ReportGenerator& reportGenerator)
+                 ReportGenerator& reportGenerator, TransactionJournal* journal)
     : productManager(pm), customerManager(cm), transaction(transaction),
       inventoryUI(inventoryUI), purchaseHistoryFormatter(purchaseHistoryFormatter),
-      reportGenerator(reportGenerator) {}
+      reportGenerator(reportGenerator), journal(journal) {}
 
 void Program::run() {
     std::cout << "\n--- Initializing Program ---\n";
@@ -14,6 +14,11 @@ void Program::run() {
     initializeCustomers();
     initializeDiscounts();
 
+    if (journal != nullptr) {
+        std::cout << "\n--- Recovering From Journal ---\n";
+        recoverFromJournal();
+    }
+
     std::cout << "\n--- Processing Transactions ---\n";
     processTransactions();
 
@@ -32,23 +37,18 @@ void Program::run() {
 void Program::initializeProducts() {
     std::cout << "\nInitializing Products...\n";
     
-    Category* electronics = new Category(1, "Electronics"); // Create Category first
-    Category* accessories = new Category(2, "Accessories");
-
-    Product* laptop = new Product(101, "Laptop", 1500.0, 10, electronics); // Use the Category
-    Product* mouse = new Product(102, "Mouse", 25.0, 50, accessories);
+    Category* electronics = productManager.createCategory(1, "Electronics"); // Create Category first
+    Category* accessories = productManager.createCategory(2, "Accessories");
 
-    productManager.addProduct(laptop);
-    productManager.addProduct(mouse);
+    productManager.emplaceProduct(101, "Laptop", 1500.0, 10, electronics); // Use the Category
+    productManager.emplaceProduct(102, "Mouse", 25.0, 50, accessories);
 }
 
 void Program::initializeCustomers() {
     std::cout << "\nInitializing Customers...\n";
     std::cout << "Adding customers...\n";
-    Customer* alice = new Customer(1, "Alice Johnson", "alice.johnson@example.com");
-    Customer* bob = new Customer(2, "Bob Smith", "bob.smith@example.com");
-    customerManager.addCustomer(alice);
-    customerManager.addCustomer(bob);
+    customerManager.emplaceCustomer(1, "Alice Johnson", "alice.johnson@example.com");
+    customerManager.emplaceCustomer(2, "Bob Smith", "bob.smith@example.com");
 }
 
 void Program::initializeDiscounts() {
@@ -60,15 +60,24 @@ void Program::initializeDiscounts() {
     productManager.setDiscount(102, flatDiscount);      // Apply to mouse
 }
 
+// Re-apply the purchases committed by earlier runs, then record the new ones. The catalog and
+// customers above are the same on every run, as replay requires.
+void Program::recoverFromJournal() {
+    std::size_t recovered = journal->replay(productManager, customerManager);
+    std::cout << "Replayed " << recovered << " purchases from the journal.\n";
+    transaction.setJournal(journal);
+}
+
 void Program::processTransactions() {
     std::cout << "Processing transactions...\n";
     transaction.processPurchase(1, 101, 2); // Alice buys 2 laptops
     transaction.processPurchase(2, 102, 3); // Bob buys 3 mice
+    transaction.flushReceipts();            // Make sure queued receipts are printed before moving on
 }
 
 void Program::displayInventory() {
     std::cout << "Inventory after transactions:\n";
-    inventoryUI.displayInventory(productManager.getAllProducts());
+    inventoryUI.streamInventory(productManager, std::cout);
 }
 
 void Program::displayPurchaseHistory() {
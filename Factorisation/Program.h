@@ -4,6 +4,7 @@
 #include "ProductManager.h"
 #include "CustomerManager.h"
 #include "Transaction.h"
+#include "TransactionJournal.h"
 #include "InventoryUI.h"
 #include "PurchaseHistoryFormatter.h"
 #include "ReportGenerator.h"
@@ -12,7 +13,7 @@ class Program {
 public:
     Program(ProductManager& pm, CustomerManager& cm, Transaction& transaction,
             InventoryUI& inventoryUI, PurchaseHistoryFormatter& purchaseHistoryFormatter,
-            ReportGenerator& reportGenerator);
+            ReportGenerator& reportGenerator, TransactionJournal* journal = nullptr);
 
     void run();
 
@@ -23,10 +24,12 @@ private:
     InventoryUI& inventoryUI;
     PurchaseHistoryFormatter& purchaseHistoryFormatter;
     ReportGenerator& reportGenerator;
+    TransactionJournal* journal; // When set, earlier purchases are replayed and new ones recorded
 
     void initializeProducts();
     void initializeCustomers();
     void initializeDiscounts();
+    void recoverFromJournal();
     void processTransactions();
     void displayInventory();
     void displayPurchaseHistory();
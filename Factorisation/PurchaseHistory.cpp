@@ -2,15 +2,41 @@
 
 // PurchaseHistory Class: Tracks purchases for a customer
 // Adheres to SRP: Manages only the storage and retrieval of purchase records.
+// Records are kept column by column and refer to products by ID, so a purchase costs 16 bytes
+// and two products that share a name stay distinct.
 
 #include "PurchaseHistory.h"
 
+PurchaseHistory::PurchaseHistory(const ProductSalesTable& products) : products(&products) {}
+
 // Add a purchase record
-void PurchaseHistory::addPurchase(const std::string& product_name, int quantity, double total_cost) {
-    history.push_back({product_name, quantity, total_cost});
+void PurchaseHistory::addPurchase(int product_id, int quantity, double total_cost) {
+    productIds.push_back(product_id);
+    quantities.push_back(quantity);
+    totalCosts.push_back(total_cost);
+    ++totals.purchases;
+    totals.units += quantity;
+    totals.revenue += total_cost;
 }
 
 // Retrieve all purchase records
-const std::vector<PurchaseHistory::Purchase>& PurchaseHistory::getHistory() const {
-    return history;
+PurchaseHistory::View PurchaseHistory::getHistory() const {
+    return View(*this);
+}
+
+// Totals over every purchase
+const PurchaseHistory::Totals& PurchaseHistory::getTotals() const {
+    return totals;
+}
+
+// Bytes used by the record columns
+std::size_t PurchaseHistory::bytes() const {
+    return productIds.capacity() * sizeof(int) + quantities.capacity() * sizeof(int) +
+           totalCosts.capacity() * sizeof(double);
+}
+
+// Assemble one record from the columns
+PurchaseHistory::Purchase PurchaseHistory::at(std::size_t index) const {
+    int product_id = productIds[index];
+    return Purchase{product_id, products->nameOf(product_id), quantities[index], totalCosts[index]};
 }
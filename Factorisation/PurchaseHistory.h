@@ -3,26 +3,85 @@
 #ifndef PURCHASE_HISTORY_H
 #define PURCHASE_HISTORY_H
 
-#include <string>
+#include <cstddef>
+#include <string_view>
 #include <vector>
+#include "ProductSalesTable.h"
 
 class PurchaseHistory {
 public:
     struct Purchase {
-        std::string product_name; // Name of the product purchased
-        int quantity;             // Quantity purchased
-        double total_cost;        // Total cost of the purchase
+        int product_id;                // Product purchased
+        std::string_view product_name; // Its current name (owned by the product table)
+        int quantity;                  // Quantity purchased
+        double total_cost;             // Total cost of the purchase
+    };
+
+    // Running totals, kept up to date as purchases are added
+    struct Totals {
+        std::size_t purchases = 0; // Number of purchase records
+        long long units = 0;       // Sum of quantities
+        double revenue = 0.0;      // Sum of total costs
+    };
+
+    // Read-only view over the history; valid until the next purchase is added. Product names
+    // are resolved from the product table as records are read, without taking a lock.
+    class View {
+    public:
+        class iterator {
+        public:
+            using value_type = Purchase;
+            using difference_type = std::ptrdiff_t;
+
+            iterator() = default;
+            iterator(const PurchaseHistory* history, std::size_t index) : history(history), index(index) {}
+
+            Purchase operator*() const { return history->at(index); }
+            iterator& operator++() { ++index; return *this; }
+            iterator operator++(int) { iterator previous = *this; ++index; return previous; }
+            bool operator==(const iterator& other) const { return index == other.index; }
+
+        private:
+            const PurchaseHistory* history = nullptr;
+            std::size_t index = 0;
+        };
+
+        explicit View(const PurchaseHistory& history) : history(&history) {}
+
+        iterator begin() const { return iterator(history, 0); }
+        iterator end() const { return iterator(history, size()); }
+        std::size_t size() const { return history->quantities.size(); }
+        bool empty() const { return size() == 0; }
+        Purchase operator[](std::size_t index) const { return history->at(index); }
+
+    private:
+        const PurchaseHistory* history;
     };
 
 private:
-    std::vector<Purchase> history; // Vector to store purchase records
+    // One column per field; names are looked up by product ID in the shared table
+    const ProductSalesTable* products;
+    std::vector<int> productIds;
+    std::vector<int> quantities;
+    std::vector<double> totalCosts;
+    Totals totals;
+
+    Purchase at(std::size_t index) const;
 
 public:
-    // Add a purchase record
-    void addPurchase(const std::string& product_name, int quantity, double total_cost);
+    explicit PurchaseHistory(const ProductSalesTable& products);
+
+    // Add a purchase record for a product whose sale is recorded in the table
+    void addPurchase(int product_id, int quantity, double total_cost);
 
     // Retrieve all purchase records
-    const std::vector<Purchase>& getHistory() const;
+    View getHistory() const;
+
+    // Totals over every purchase, without walking the records
+    const Totals& getTotals() const;
+
+    // Bytes used by the record columns
+    std::size_t bytes() const;
 };
 
 #endif // PURCHASE_HISTORY_H
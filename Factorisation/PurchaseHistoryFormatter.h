@@ -6,7 +6,7 @@
 
 class PurchaseHistoryFormatter {
 public:
-    virtual std::string formatHistory(const std::vector<PurchaseHistory::Purchase>& history) const = 0;
+    virtual std::string formatHistory(PurchaseHistory::View history) const = 0;
     virtual ~PurchaseHistoryFormatter() = default;
 };
 
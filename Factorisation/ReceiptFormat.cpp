@@ -1,28 +1,58 @@
 
 
 #include "ReceiptFormat.h"
+#include "ReceiptTemplate.h"
+
+namespace {
+
+// Receipt layouts, compiled once
+const ReceiptTemplate textTemplate(
+    "\n--- Receipt ---\n"
+    "Customer: {customer}\n"
+    "Product: {product}\n"
+    "Quantity: {quantity}\n"
+    "Total Cost: ${total}\n"
+    "-----------------\n\n");
+
+const ReceiptTemplate htmlTemplate(
+    "<html>\n<head><title>Receipt</title></head>\n<body>\n"
+    "<h1>Receipt</h1>\n"
+    "<p><strong>Customer:</strong> {customer}</p>\n"
+    "<p><strong>Product:</strong> {product}</p>\n"
+    "<p><strong>Quantity:</strong> {quantity}</p>\n"
+    "<p><strong>Total Cost:</strong> ${total}</p>\n"
+    "</body>\n</html>\n");
+
+// Render a template into a new string
+std::string renderToString(const ReceiptTemplate& layout, const std::string& customerName,
+                           const std::string& productName, int quantity, double totalCost) {
+    std::string receipt;
+    receipt.reserve(layout.literalLength() + customerName.size() + productName.size() + 32);
+    layout.render(receipt, customerName, productName, quantity, totalCost);
+    return receipt;
+}
+
+} // namespace
+
+// Default rendering for formats that only implement generateReceipt
+void ReceiptFormat::renderReceipt(std::string& out, std::string_view customerName, std::string_view productName, int quantity, double totalCost) const {
+    out += generateReceipt(std::string(customerName), std::string(productName), quantity, totalCost);
+}
 
 // Plain text receipt format
 std::string TextReceiptFormat::generateReceipt(const std::string& customerName, const std::string& productName, int quantity, double totalCost) const {
-    std::ostringstream receipt;
-    receipt << "\n--- Receipt ---\n";
-    receipt << "Customer: " << customerName << "\n";
-    receipt << "Product: " << productName << "\n";
-    receipt << "Quantity: " << quantity << "\n";
-    receipt << "Total Cost: $" << std::fixed << std::setprecision(2) << totalCost << "\n";
-    receipt << "-----------------\n\n";
-    return receipt.str();
+    return renderToString(textTemplate, customerName, productName, quantity, totalCost);
+}
+
+void TextReceiptFormat::renderReceipt(std::string& out, std::string_view customerName, std::string_view productName, int quantity, double totalCost) const {
+    textTemplate.render(out, customerName, productName, quantity, totalCost);
 }
 
 // HTML receipt format
 std::string HTMLReceiptFormat::generateReceipt(const std::string& customerName, const std::string& productName, int quantity, double totalCost) const {
-    std::ostringstream receipt;
-    receipt << "<html>\n<head><title>Receipt</title></head>\n<body>\n";
-    receipt << "<h1>Receipt</h1>\n";
-    receipt << "<p><strong>Customer:</strong> " << customerName << "</p>\n";
-    receipt << "<p><strong>Product:</strong> " << productName << "</p>\n";
-    receipt << "<p><strong>Quantity:</strong> " << quantity << "</p>\n";
-    receipt << "<p><strong>Total Cost:</strong> $" << std::fixed << std::setprecision(2) << totalCost << "</p>\n";
-    receipt << "</body>\n</html>\n";
-    return receipt.str();
+    return renderToString(htmlTemplate, customerName, productName, quantity, totalCost);
+}
+
+void HTMLReceiptFormat::renderReceipt(std::string& out, std::string_view customerName, std::string_view productName, int quantity, double totalCost) const {
+    htmlTemplate.render(out, customerName, productName, quantity, totalCost);
 }
@@ -4,13 +4,17 @@
 #define RECEIPT_FORMAT_H
 
 #include <string>
-#include <sstream>
-#include <iomanip>
+#include <string_view>
 
 // Abstract class for receipt format
 class ReceiptFormat {
 public:
     virtual std::string generateReceipt(const std::string& customerName, const std::string& productName, int quantity, double totalCost) const = 0;
+
+    // Append the receipt to a caller-provided buffer. Formats that can render without
+    // temporaries override this; the default appends the result of generateReceipt.
+    virtual void renderReceipt(std::string& out, std::string_view customerName, std::string_view productName, int quantity, double totalCost) const;
+
     virtual ~ReceiptFormat() = default;
 };
 
@@ -18,12 +22,14 @@ public:
 class TextReceiptFormat : public ReceiptFormat {
 public:
     std::string generateReceipt(const std::string& customerName, const std::string& productName, int quantity, double totalCost) const override;
+    void renderReceipt(std::string& out, std::string_view customerName, std::string_view productName, int quantity, double totalCost) const override;
 };
 
 // HTML receipt format
 class HTMLReceiptFormat : public ReceiptFormat {
 public:
     std::string generateReceipt(const std::string& customerName, const std::string& productName, int quantity, double totalCost) const override;
+    void renderReceipt(std::string& out, std::string_view customerName, std::string_view productName, int quantity, double totalCost) const override;
 };
 
 #endif // RECEIPT_FORMAT_H
@@ -0,0 +1,51 @@
+
+
+#include "ReceiptSink.h"
+#include <iostream>
+#include <stdexcept>
+
+// Adheres to OCP: New destinations for receipts (queues, network, ...) are added as new
+// sinks without changing Transaction.
+
+// Console sink
+void ConsoleReceiptSink::write(std::string_view text) {
+    std::cout.write(text.data(), static_cast<std::streamsize>(text.size()));
+}
+
+void ConsoleReceiptSink::flush() {
+    std::cout.flush();
+}
+
+// Null sink
+void NullReceiptSink::write(std::string_view) {}
+
+void NullReceiptSink::flush() {}
+
+// File sink
+FileReceiptSink::FileReceiptSink(const std::string& path, std::size_t batchBytes)
+    : file(path, std::ios::out | std::ios::app | std::ios::binary), batchBytes(batchBytes) {
+    if (!file) {
+        throw std::runtime_error("Cannot open receipt file: " + path);
+    }
+    pending.reserve(batchBytes);
+}
+
+FileReceiptSink::~FileReceiptSink() {
+    flush();
+}
+
+void FileReceiptSink::write(std::string_view text) {
+    pending.append(text);
+    if (pending.size() >= batchBytes) {
+        file.write(pending.data(), static_cast<std::streamsize>(pending.size()));
+        pending.clear();
+    }
+}
+
+void FileReceiptSink::flush() {
+    if (!pending.empty()) {
+        file.write(pending.data(), static_cast<std::streamsize>(pending.size()));
+        pending.clear();
+    }
+    file.flush();
+}
@@ -0,0 +1,49 @@
+
+
+#ifndef RECEIPT_SINK_H
+#define RECEIPT_SINK_H
+
+#include <cstddef>
+#include <fstream>
+#include <string>
+#include <string_view>
+
+// Abstract destination for receipts and transaction details
+class ReceiptSink {
+public:
+    virtual void write(std::string_view text) = 0;
+    virtual void flush() = 0;
+    virtual ~ReceiptSink() = default;
+};
+
+// Writes straight to std::cout
+class ConsoleReceiptSink : public ReceiptSink {
+public:
+    void write(std::string_view text) override;
+    void flush() override;
+};
+
+// Discards everything (for benchmarks)
+class NullReceiptSink : public ReceiptSink {
+public:
+    void write(std::string_view text) override;
+    void flush() override;
+};
+
+// Appends to a file, collecting writes in memory and writing them out in large blocks.
+// Not thread-safe on its own; wrap it in an AsyncReceiptSink for concurrent producers.
+class FileReceiptSink : public ReceiptSink {
+public:
+    explicit FileReceiptSink(const std::string& path, std::size_t batchBytes = 1 << 20);
+    ~FileReceiptSink() override;
+
+    void write(std::string_view text) override;
+    void flush() override;
+
+private:
+    std::ofstream file;
+    std::string pending;    // Text not yet handed to the file
+    std::size_t batchBytes; // Size at which pending text is written out
+};
+
+#endif // RECEIPT_SINK_H
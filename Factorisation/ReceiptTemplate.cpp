@@ -0,0 +1,64 @@
+
+
+#include "ReceiptTemplate.h"
+#include "FormatUtils.h"
+#include <stdexcept>
+#include <utility>
+#include <string>
+
+// Compile the pattern into literal segments and fields
+ReceiptTemplate::ReceiptTemplate(std::string_view pattern) {
+    static constexpr std::pair<std::string_view, Field> placeholders[] = {
+        {"{customer}", Field::Customer},
+        {"{product}", Field::Product},
+        {"{quantity}", Field::Quantity},
+        {"{total}", Field::TotalCost},
+    };
+
+    while (!pattern.empty()) {
+        std::size_t open = pattern.find('{');
+        if (open == std::string_view::npos) {
+            segments.push_back({pattern, Field::None});
+            literalBytes += pattern.size();
+            break;
+        }
+
+        std::string_view rest = pattern.substr(open);
+        Field field = Field::None;
+        std::size_t placeholderLength = 0;
+        for (const auto& placeholder : placeholders) {
+            if (rest.starts_with(placeholder.first)) {
+                field = placeholder.second;
+                placeholderLength = placeholder.first.size();
+                break;
+            }
+        }
+        if (field == Field::None) {
+            throw std::invalid_argument("Unknown receipt placeholder in: " + std::string(rest.substr(0, 16)));
+        }
+
+        segments.push_back({pattern.substr(0, open), field});
+        literalBytes += open;
+        pattern.remove_prefix(open + placeholderLength);
+    }
+}
+
+// Append a rendered receipt to out
+void ReceiptTemplate::render(std::string& out, std::string_view customerName, std::string_view productName,
+                             int quantity, double totalCost) const {
+    for (const Segment& segment : segments) {
+        out.append(segment.literal);
+        switch (segment.field) {
+            case Field::Customer: out.append(customerName); break;
+            case Field::Product: out.append(productName); break;
+            case Field::Quantity: appendInteger(out, quantity); break;
+            case Field::TotalCost: appendFixed2(out, totalCost); break;
+            case Field::None: break;
+        }
+    }
+}
+
+// Length of the literal text
+std::size_t ReceiptTemplate::literalLength() const {
+    return literalBytes;
+}
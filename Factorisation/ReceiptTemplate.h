@@ -0,0 +1,38 @@
+
+
+#ifndef RECEIPT_TEMPLATE_H
+#define RECEIPT_TEMPLATE_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// A receipt layout compiled once from a pattern such as "Customer: {customer}\n".
+// Supported placeholders are {customer}, {product}, {quantity} and {total}.
+// Rendering appends literal segments and formatted fields to a caller-owned buffer,
+// so a reused buffer makes rendering allocation-free.
+class ReceiptTemplate {
+public:
+    // The pattern must outlive the template (string literals are the intended use)
+    explicit ReceiptTemplate(std::string_view pattern);
+
+    void render(std::string& out, std::string_view customerName, std::string_view productName,
+                int quantity, double totalCost) const;
+
+    // Length of the literal text, used to size buffers
+    std::size_t literalLength() const;
+
+private:
+    enum class Field { None, Customer, Product, Quantity, TotalCost };
+
+    struct Segment {
+        std::string_view literal; // Text copied as-is
+        Field field;              // Field rendered after the literal
+    };
+
+    std::vector<Segment> segments;
+    std::size_t literalBytes = 0;
+};
+
+#endif // RECEIPT_TEMPLATE_H
@@ -0,0 +1,69 @@
+
+
+#include "Repricing.h"
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define REPRICING_HAS_AVX2_KERNEL 1
+#include <immintrin.h>
+#endif
+
+// Portable kernel; written like Discount::applyDiscount so the results are identical
+void repriceLinearScalar(const double* prices, const double* multipliers, const double* subtrahends,
+                         const double* floors, double* out, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+        double price = prices[i] * multipliers[i] - subtrahends[i];
+        out[i] = floors[i] < price ? price : floors[i]; // std::max(floor, price)
+    }
+}
+
+#ifdef REPRICING_HAS_AVX2_KERNEL
+
+namespace {
+
+// Four prices per instruction. Multiply and subtract stay separate (no FMA) to round exactly
+// like the scalar code, and max_pd takes the floor as its second operand so ties and NaNs
+// resolve to the floor, as std::max(floor, price) does.
+__attribute__((target("avx2")))
+void repriceLinearAvx2(const double* prices, const double* multipliers, const double* subtrahends,
+                       const double* floors, double* out, std::size_t count) {
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m256d price = _mm256_mul_pd(_mm256_loadu_pd(prices + i), _mm256_loadu_pd(multipliers + i));
+        price = _mm256_sub_pd(price, _mm256_loadu_pd(subtrahends + i));
+        _mm256_storeu_pd(out + i, _mm256_max_pd(price, _mm256_loadu_pd(floors + i)));
+    }
+    repriceLinearScalar(prices + i, multipliers + i, subtrahends + i, floors + i, out + i, count - i);
+}
+
+bool cpuHasAvx2() {
+    static const bool supported = __builtin_cpu_supports("avx2");
+    return supported;
+}
+
+} // namespace
+
+void repriceLinear(const double* prices, const double* multipliers, const double* subtrahends,
+                   const double* floors, double* out, std::size_t count) {
+    if (cpuHasAvx2()) {
+        repriceLinearAvx2(prices, multipliers, subtrahends, floors, out, count);
+    } else {
+        repriceLinearScalar(prices, multipliers, subtrahends, floors, out, count);
+    }
+}
+
+const char* repricingKernelName() {
+    return cpuHasAvx2() ? "avx2" : "scalar";
+}
+
+#else
+
+void repriceLinear(const double* prices, const double* multipliers, const double* subtrahends,
+                   const double* floors, double* out, std::size_t count) {
+    repriceLinearScalar(prices, multipliers, subtrahends, floors, out, count);
+}
+
+const char* repricingKernelName() {
+    return "scalar";
+}
+
+#endif
@@ -0,0 +1,24 @@
+
+
+#ifndef REPRICING_H
+#define REPRICING_H
+
+#include <cstddef>
+
+// Bulk discount kernels over contiguous arrays:
+//   out[i] = max(floors[i], prices[i] * multipliers[i] - subtrahends[i])
+// which is the compiled form of every single-rule Discount. All kernels produce exactly the
+// prices Discount::applyDiscount would.
+
+// Picks the widest kernel the CPU supports (AVX2 where available), decided once at runtime
+void repriceLinear(const double* prices, const double* multipliers, const double* subtrahends,
+                   const double* floors, double* out, std::size_t count);
+
+// Portable one-element-at-a-time kernel
+void repriceLinearScalar(const double* prices, const double* multipliers, const double* subtrahends,
+                         const double* floors, double* out, std::size_t count);
+
+// Name of the kernel repriceLinear uses on this machine ("avx2" or "scalar")
+const char* repricingKernelName();
+
+#endif // REPRICING_H
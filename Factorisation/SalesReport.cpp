@@ -1,31 +1,50 @@
 // SalesReport.cpp
 #include "SalesReport.h"
+#include "Instrumentation.h"
+#include "ShardedRender.h"
 #include <sstream>
+#include <utility>
+#include <vector>
 
-SalesReport::SalesReport(const CustomerManager& customerManager) : customerManager(customerManager) {}
+SalesReport::SalesReport(const CustomerManager& customerManager, std::size_t topProductCount,
+                         ThreadPool* pool, std::size_t shardSize)
+    : customerManager(customerManager), topProductCount(topProductCount), pool(pool), shardSize(shardSize) {}
 
 std::string SalesReport::generate() const {
+    FACTORISATION_TIME_SCOPE(reportTimer, Stage::SalesReport);
     std::ostringstream oss;
     oss << "Sales Report:\n";
-    // Logic to generate sales report using customerManager data
-    // (Iterate through customers, get their purchase histories, etc.)
-    for (const auto& customerPair : customerManager.getAllCustomers()) {
-        int customerId = customerPair.first;
-        const Customer* customer = customerPair.second;
-        oss << "Customer: " << customer->getName() << " (ID: " << customerId << ")\n";
+    // Built from the running totals CustomerManager keeps as purchases are added,
+    // so the cost grows with the number of customers rather than the number of purchases
+    const auto& customers = customerManager.getAllCustomers();
+    std::vector<std::pair<int, const Customer*>> customerList(customers.begin(), customers.end());
 
-        try {
-            const std::vector<PurchaseHistory::Purchase>& purchases = customerManager.getPurchaseHistory(customerId);
-            if (purchases.empty()) {
-                oss << "  No purchases found.\n";
+    oss << renderInShards(pool, customerList.size(), shardSize, [&](std::size_t begin, std::size_t end) {
+        std::ostringstream shard;
+        for (std::size_t i = begin; i < end; ++i) {
+            int customerId = customerList[i].first;
+            const Customer* customer = customerList[i].second;
+            shard << "Customer: " << customer->getName() << " (ID: " << customerId << ")\n";
+
+            PurchaseHistory::Totals totals = customerManager.getPurchaseTotals(customerId);
+            if (totals.purchases == 0) {
+                shard << "  No purchases found.\n";
             } else {
-                for (const auto& purchase : purchases) {
-                    oss << "  - Bought " << purchase.quantity << " " << purchase.product_name
-                        << " for $" << purchase.total_cost << "\n";
-                }
+                shard << "  Purchases: " << totals.purchases << ", Units: " << totals.units
+                      << ", Revenue: $" << totals.revenue << "\n";
+            }
+        }
+        return shard.str();
+    });
+
+    if (topProductCount > 0) {
+        std::vector<CustomerManager::ProductSales> topProducts = customerManager.getTopProducts(topProductCount);
+        if (!topProducts.empty()) {
+            oss << "Top Products:\n";
+            for (const auto& product : topProducts) {
+                oss << "  - " << product.product_name << ": " << product.totals.units
+                    << " units, $" << product.totals.revenue << "\n";
             }
-        } catch (const std::exception& e) {
-            oss << "  Error retrieving purchase history: " << e.what() << "\n";
         }
     }
     return oss.str();
@@ -4,16 +4,25 @@
 
 #include "Report.h"
 #include "CustomerManager.h"
+#include "ThreadPool.h"
+#include <cstddef>
 
 class SalesReport : public Report {
 public:
-    SalesReport(const CustomerManager& customerManager);
+    // Lists every customer's totals, followed by the topProductCount best-selling products.
+    // With a thread pool, customers are rendered in shards of shardSize in parallel;
+    // the text is identical either way.
+    SalesReport(const CustomerManager& customerManager, std::size_t topProductCount = 5,
+                ThreadPool* pool = nullptr, std::size_t shardSize = 16384);
     std::string generate() const override;
 
 private:
     const CustomerManager& customerManager;
+    std::size_t topProductCount;
+    ThreadPool* pool;
+    std::size_t shardSize;
 };
 
 #endif // SALES_REPORT_H
 
-    
\ No newline at end of file
+    
\ No newline at end of file
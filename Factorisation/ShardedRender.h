@@ -0,0 +1,53 @@
+
+
+#ifndef SHARDED_RENDER_H
+#define SHARDED_RENDER_H
+
+#include <cstddef>
+#include <future>
+#include <string>
+#include <vector>
+#include "ThreadPool.h"
+
+// Render items [0, count) as consecutive shards of shardSize items and join the shard texts
+// in order. renderRange(begin, end) must return the text for that range and must not depend
+// on other shards, so the result is identical to rendering the whole range at once.
+// Shards run on the pool when one is given and there is more than one shard.
+template <typename RenderRange>
+std::string renderInShards(ThreadPool* pool, std::size_t count, std::size_t shardSize, RenderRange renderRange) {
+    if (shardSize == 0) {
+        shardSize = 1;
+    }
+    if (pool == nullptr || count <= shardSize) {
+        return renderRange(std::size_t{0}, count);
+    }
+
+    std::vector<std::future<std::string>> shards;
+    shards.reserve((count + shardSize - 1) / shardSize);
+    for (std::size_t begin = 0; begin < count; begin += shardSize) {
+        std::size_t end = begin + shardSize < count ? begin + shardSize : count;
+        shards.push_back(pool->submit([&renderRange, begin, end] { return renderRange(begin, end); }));
+    }
+
+    // Let every shard finish before collecting, so a failing shard cannot leave others running
+    for (auto& shard : shards) {
+        shard.wait();
+    }
+
+    std::vector<std::string> texts;
+    texts.reserve(shards.size());
+    std::size_t totalLength = 0;
+    for (auto& shard : shards) {
+        texts.push_back(shard.get());
+        totalLength += texts.back().size();
+    }
+
+    std::string joined;
+    joined.reserve(totalLength);
+    for (const std::string& text : texts) {
+        joined += text;
+    }
+    return joined;
+}
+
+#endif // SHARDED_RENDER_H
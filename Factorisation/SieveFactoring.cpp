@@ -0,0 +1,56 @@
+
+
+#include "SieveFactoring.h"
+#include "FactorizationBatch.h"
+#include <stdexcept>
+#include <string>
+
+// SieveFactoring Class: Factors small numbers by table lookup
+// Adheres to LSP: Usable anywhere a FactoringMethod is expected (within its limit).
+
+// Sieve of Eratosthenes recording the first prime that crosses out each number
+SieveFactoring::SieveFactoring(std::uint32_t limit)
+    : limit(checkedLimit(limit)), smallestFactor(static_cast<std::size_t>(this->limit) + 1, 0) {
+    for (std::uint64_t prime = 2; prime * prime <= limit; ++prime) {
+        if (smallestFactor[prime] != 0) {
+            continue;
+        }
+        for (std::uint64_t multiple = prime * prime; multiple <= limit; multiple += prime) {
+            if (smallestFactor[multiple] == 0) {
+                smallestFactor[multiple] = static_cast<std::uint16_t>(prime);
+            }
+        }
+    }
+}
+
+// Reject a limit the table cannot cover before trying to allocate 2^32 entries for it
+std::uint32_t SieveFactoring::checkedLimit(std::uint32_t limit) {
+    if (limit == UINT32_MAX) {
+        throw std::invalid_argument("Sieve limit must be below 2^32");
+    }
+    return limit;
+}
+
+std::vector<std::uint64_t> SieveFactoring::factorize(std::uint64_t number) const {
+    if (number > limit) {
+        throw std::out_of_range("Number " + std::to_string(number) + " exceeds the sieve limit " + std::to_string(limit));
+    }
+    std::vector<std::uint64_t> factors;
+    appendFactors(static_cast<std::uint32_t>(number), factors);
+    return factors;
+}
+
+void SieveFactoring::factorizeBatch(std::span<const std::uint64_t> numbers, FactorizationBatch& out, ThreadPool* pool) const {
+    for (std::uint64_t number : numbers) {
+        if (number > limit) {
+            throw std::out_of_range("Number " + std::to_string(number) + " exceeds the sieve limit " + std::to_string(limit));
+        }
+    }
+    factorizeInParallel(numbers, out, pool, [this](std::uint64_t number, std::vector<std::uint64_t>& factors) {
+        appendFactors(static_cast<std::uint32_t>(number), factors);
+    });
+}
+
+std::uint32_t SieveFactoring::getLimit() const {
+    return limit;
+}
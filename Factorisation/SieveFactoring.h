@@ -0,0 +1,45 @@
+
+
+#ifndef SIEVE_FACTORING_H
+#define SIEVE_FACTORING_H
+
+#include <cstdint>
+#include <vector>
+#include "FactoringMethod.h"
+
+// Factors numbers up to a fixed limit by following a precomputed smallest-prime-factor table,
+// one division per factor. Building the table costs time and two bytes per number up to the
+// limit; larger numbers throw std::out_of_range.
+class SieveFactoring : public FactoringMethod {
+public:
+    // limit must be below 2^32
+    explicit SieveFactoring(std::uint32_t limit = 1u << 20);
+
+    using FactoringMethod::factorize;
+    std::vector<std::uint64_t> factorize(std::uint64_t number) const override;
+    void factorizeBatch(std::span<const std::uint64_t> numbers, FactorizationBatch& out, ThreadPool* pool = nullptr) const override;
+
+    // Largest number the table covers
+    std::uint32_t getLimit() const;
+
+    // Append the factors of number (at most the limit) to factors (non-virtual; used by the
+    // batch API and AdaptiveFactoring)
+    void appendFactors(std::uint32_t number, std::vector<std::uint64_t>& factors) const {
+        while (number > 1) {
+            std::uint32_t prime = smallestFactor[number] != 0 ? smallestFactor[number] : number;
+            factors.push_back(prime);
+            number /= prime;
+        }
+    }
+
+private:
+    std::uint32_t limit;
+    // Smallest prime factor of each composite; 0 for primes (and 0 and 1). A composite's
+    // smallest prime factor is at most the square root of 2^32, so it fits in 16 bits.
+    std::vector<std::uint16_t> smallestFactor;
+
+    // The limit, checked before the table is allocated
+    static std::uint32_t checkedLimit(std::uint32_t limit);
+};
+
+#endif // SIEVE_FACTORING_H
@@ -0,0 +1,151 @@
+
+
+#ifndef STATIC_SIEVE_H
+#define STATIC_SIEVE_H
+
+#include <algorithm> // For std::sort
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "FactorKernels.h"
+#include "FactoringMethod.h"
+#include "FactorizationBatch.h"
+
+// Prime factors of one number held by value (at most 64, for 2^64), usable in constant
+// expressions
+struct StaticFactors {
+    std::array<std::uint64_t, 64> values{};
+    std::size_t count = 0;
+
+    constexpr const std::uint64_t* begin() const { return values.data(); }
+    constexpr const std::uint64_t* end() const { return values.data() + count; }
+    constexpr std::size_t size() const { return count; }
+    constexpr std::uint64_t operator[](std::size_t index) const { return values[index]; }
+};
+
+// Factor a constant: trial division by small primes, then Miller-Rabin and Pollard's rho
+// (the FactorKernels routines) on what is left. Runs entirely at compile time when used in
+// a constant expression (see kFactorsOf), even for 64-bit semiprimes.
+constexpr StaticFactors factorizeConstant(std::uint64_t number) {
+    constexpr std::uint64_t kTrialLimit = 1024;
+    StaticFactors factors;
+    for (std::uint64_t prime = 2; number > 1 && prime < kTrialLimit && prime <= number / prime; prime += prime == 2 ? 1 : 2) {
+        while (number % prime == 0) {
+            factors.values[factors.count++] = prime;
+            number /= prime;
+        }
+    }
+
+    // The cofactor has no prime factor below kTrialLimit, so it has at most 6 and an explicit
+    // stack of pending parts never holds more than that
+    std::array<std::uint64_t, 8> pending{};
+    std::size_t pendingCount = 0;
+    if (number > 1) {
+        pending[pendingCount++] = number;
+    }
+    while (pendingCount != 0) {
+        std::uint64_t part = pending[--pendingCount];
+        if (isPrime(part)) {
+            factors.values[factors.count++] = part;
+            continue;
+        }
+        std::uint64_t divisor = brentDivisor(part);
+        pending[pendingCount++] = divisor;
+        pending[pendingCount++] = part / divisor;
+    }
+    std::sort(factors.values.begin(), factors.values.begin() + factors.count);
+    return factors;
+}
+
+// Factors of a compile-time constant, e.g. kFactorsOf<360> is {2, 2, 2, 3, 3, 5}
+template <std::uint64_t Number>
+inline constexpr StaticFactors kFactorsOf = factorizeConstant(Number);
+
+// Smallest prime factor of every composite up to Bound (0 for primes, 0 and 1), built by the
+// compiler
+template <std::uint32_t Bound>
+constexpr std::array<std::uint16_t, Bound + std::size_t{1}> makeSmallestFactorTable() {
+    static_assert(Bound < UINT32_MAX, "Smallest prime factors only fit in 16 bits below 2^32");
+    std::array<std::uint16_t, Bound + std::size_t{1}> table{};
+    for (std::uint64_t prime = 2; prime * prime <= Bound; ++prime) {
+        if (table[prime] != 0) {
+            continue;
+        }
+        for (std::uint64_t multiple = prime * prime; multiple <= Bound; multiple += prime) {
+            if (table[multiple] == 0) {
+                table[multiple] = static_cast<std::uint16_t>(prime);
+            }
+        }
+    }
+    return table;
+}
+
+// Factorization of numbers up to Bound by a smallest-prime-factor table computed at compile
+// time and stored in the binary (2 bytes per number; compile time grows with Bound, which
+// GCC's constexpr limits cap at a few million). Everything is static and inlinable: this is
+// the fast path for small numbers, with no virtual dispatch and no allocation.
+template <std::uint32_t Bound>
+class StaticSieve {
+public:
+    static constexpr std::uint32_t kBound = Bound;
+
+    // Call visit(prime) for each prime factor of number (at most Bound) in ascending order
+    template <typename Visitor>
+    static constexpr void forEachFactor(std::uint32_t number, Visitor&& visit) {
+        while (number > 1) {
+            std::uint32_t prime = table[number] != 0 ? table[number] : number;
+            visit(prime);
+            number /= prime;
+        }
+    }
+
+    static constexpr StaticFactors factorize(std::uint32_t number) {
+        StaticFactors factors;
+        forEachFactor(number, [&factors](std::uint32_t prime) { factors.values[factors.count++] = prime; });
+        return factors;
+    }
+
+    static constexpr bool isPrime(std::uint32_t number) {
+        return number >= 2 && table[number] == 0;
+    }
+
+private:
+    static constexpr std::array<std::uint16_t, Bound + std::size_t{1}> table = makeSmallestFactorTable<Bound>();
+};
+
+// FactoringMethod adapter for StaticSieve, for callers that pick an engine at runtime.
+// Numbers above Bound throw std::out_of_range.
+template <std::uint32_t Bound>
+class StaticSieveFactoring : public FactoringMethod {
+public:
+    using FactoringMethod::factorize;
+
+    std::vector<std::uint64_t> factorize(std::uint64_t number) const override {
+        checkBound(number);
+        std::vector<std::uint64_t> factors;
+        StaticSieve<Bound>::forEachFactor(static_cast<std::uint32_t>(number), [&factors](std::uint32_t prime) { factors.push_back(prime); });
+        return factors;
+    }
+
+    void factorizeBatch(std::span<const std::uint64_t> numbers, FactorizationBatch& out, ThreadPool* pool = nullptr) const override {
+        for (std::uint64_t number : numbers) {
+            checkBound(number);
+        }
+        factorizeInParallel(numbers, out, pool, [](std::uint64_t number, std::vector<std::uint64_t>& factors) {
+            StaticSieve<Bound>::forEachFactor(static_cast<std::uint32_t>(number), [&factors](std::uint32_t prime) { factors.push_back(prime); });
+        });
+    }
+
+private:
+    static void checkBound(std::uint64_t number) {
+        if (number > Bound) {
+            throw std::out_of_range("Number " + std::to_string(number) + " exceeds the static sieve bound " + std::to_string(Bound));
+        }
+    }
+};
+
+#endif // STATIC_SIEVE_H
@@ -0,0 +1,274 @@
+
+
+#include "StoreSnapshot.h"
+#include "MappedFile.h"
+#include <cstdio>  // For std::rename, std::remove
+#include <cstring>
+#include <map>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+// StoreSnapshot Class: Saves and restores the complete store state
+// Adheres to SRP: Only converts between the managers and the snapshot file; the managers still
+// validate everything that is loaded into them.
+
+namespace {
+
+constexpr char kMagic[8] = {'S', 'O', 'L', 'I', 'D', 'S', 'N', 'P'};
+constexpr std::size_t kAlignment = 8; // Every section starts on an 8-byte boundary
+
+using Snapshot = StoreSnapshot;
+
+// Builds the file image section by section
+class ImageBuilder {
+public:
+    ImageBuilder() : image(sizeof(Snapshot::Header)) {}
+
+    Snapshot::StringRef addString(std::string_view text) {
+        Snapshot::StringRef ref{strings.size(), text.size()};
+        strings.append(text);
+        return ref;
+    }
+
+    // For text repeated across records: stored once per distinct view, which must outlive the builder
+    Snapshot::StringRef addSharedString(std::string_view text) {
+        auto it = sharedStrings.find(text);
+        if (it == sharedStrings.end()) {
+            it = sharedStrings.emplace(text, addString(text)).first;
+        }
+        return it->second;
+    }
+
+    template <typename Record>
+    void addSection(Snapshot::SectionIndex index, const std::vector<Record>& records) {
+        static_assert(std::is_trivially_copyable_v<Record>);
+        appendSection(index, records.data(), records.size() * sizeof(Record), records.size());
+    }
+
+    // Lay out the string section and the header; returns the finished image
+    std::vector<char>& finish() {
+        appendSection(Snapshot::Strings, strings.data(), strings.size(), strings.size());
+        Snapshot::Header header{};
+        std::memcpy(header.magic, kMagic, sizeof(kMagic));
+        header.version = Snapshot::kVersion;
+        header.sectionCount = Snapshot::kSectionCount;
+        header.fileSize = image.size();
+        std::memcpy(header.sections, sections, sizeof(sections));
+        std::memcpy(image.data(), &header, sizeof(header));
+        return image;
+    }
+
+private:
+    std::vector<char> image;
+    Snapshot::Section sections[Snapshot::kSectionCount] = {};
+    std::string strings;
+    std::unordered_map<std::string_view, Snapshot::StringRef> sharedStrings;
+
+    void appendSection(Snapshot::SectionIndex index, const void* data, std::size_t bytes, std::size_t count) {
+        image.resize((image.size() + kAlignment - 1) / kAlignment * kAlignment);
+        sections[index] = Snapshot::Section{image.size(), count};
+        const char* begin = static_cast<const char*>(data);
+        image.insert(image.end(), begin, begin + bytes);
+    }
+};
+
+// Bounds-checked access to a mapped snapshot
+class ImageReader {
+public:
+    ImageReader(const std::string& path, const MappedFile& file) : path(path), file(file) {
+        if (file.size() < sizeof(Snapshot::Header)) {
+            fail("Not a store snapshot");
+        }
+        std::memcpy(&header, file.data(), sizeof(header));
+        if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0) {
+            fail("Not a store snapshot");
+        }
+        if (header.version != Snapshot::kVersion || header.sectionCount != Snapshot::kSectionCount) {
+            fail("Unsupported store snapshot version");
+        }
+        if (header.fileSize != file.size()) {
+            fail("Truncated store snapshot");
+        }
+        strings = std::string_view(section<char>(Snapshot::Strings).data(), header.sections[Snapshot::Strings].count);
+    }
+
+    // Records of one section, checked to lie inside the file
+    template <typename Record>
+    std::span<const Record> section(Snapshot::SectionIndex index) const {
+        const Snapshot::Section& entry = header.sections[index];
+        if (entry.offset % kAlignment != 0 || entry.offset > file.size() ||
+            entry.count > (file.size() - entry.offset) / sizeof(Record)) {
+            fail("Damaged store snapshot section");
+        }
+        return std::span<const Record>(reinterpret_cast<const Record*>(file.data() + entry.offset), entry.count);
+    }
+
+    std::string_view text(const Snapshot::StringRef& ref) const {
+        if (ref.offset > strings.size() || ref.length > strings.size() - ref.offset) {
+            fail("Damaged store snapshot string");
+        }
+        return strings.substr(ref.offset, ref.length);
+    }
+
+    [[noreturn]] void fail(const std::string& what) const {
+        throw std::runtime_error(what + ": " + path);
+    }
+
+private:
+    const std::string& path;
+    const MappedFile& file;
+    Snapshot::Header header;
+    std::string_view strings;
+};
+
+// Make a completed rename survive a crash by syncing the directory that holds it
+void syncDirectoryOf(const std::string& path) {
+#if defined(__unix__) || defined(__APPLE__)
+    std::size_t slash = path.find_last_of('/');
+    std::string directory = slash == std::string::npos ? "." : (slash == 0 ? "/" : path.substr(0, slash));
+    int fd = ::open(directory.c_str(), O_RDONLY);
+    if (fd >= 0) {
+        ::fsync(fd);
+        ::close(fd);
+    }
+#else
+    (void)path;
+#endif
+}
+
+} // namespace
+
+// Write a snapshot of the managers' state
+void StoreSnapshot::write(const std::string& path, const ProductManager& productManager, const CustomerManager& customerManager) {
+    ImageBuilder builder;
+    ProductCatalog::IdOrderView products = productManager.productsInIdOrder();
+
+    // Owned categories plus any other category a product refers to, by ID
+    std::map<int, const Category*> categoriesById;
+    for (const Category* category : productManager.getAllCategories()) {
+        categoriesById.emplace(category->getCategoryId(), category);
+    }
+    for (const Product* product : products) {
+        if (product->getCategory() != nullptr) {
+            categoriesById.emplace(product->getCategory()->getCategoryId(), product->getCategory());
+        }
+    }
+    std::vector<CategoryRecord> categoryRecords;
+    categoryRecords.reserve(categoriesById.size());
+    for (const auto& [category_id, category] : categoriesById) {
+        categoryRecords.push_back(CategoryRecord{category_id, 0, builder.addString(category->getName())});
+    }
+    builder.addSection(Categories, categoryRecords);
+
+    std::vector<ProductRecord> productRecords;
+    productRecords.reserve(products.size());
+    std::vector<DiscountRecord> discountRecords;
+    for (const Product* product : products) {
+        const Category* category = product->getCategory();
+        productRecords.push_back(ProductRecord{product->getProductId(), product->getQuantity(), product->getPrice(),
+                                               category != nullptr ? category->getCategoryId() : 0,
+                                               category != nullptr ? 1u : 0u, builder.addString(product->getName())});
+        if (const Discount* discount = productManager.findDiscount(product->getProductId())) {
+            DiscountRecord record{};
+            record.product_id = product->getProductId();
+            record.stepCount = static_cast<std::uint32_t>(discount->getStepCount());
+            for (std::size_t i = 0; i < discount->getStepCount(); ++i) {
+                record.steps[i] = DiscountRecord::Step{static_cast<std::uint32_t>(discount->getStep(i).rule), 0,
+                                                       discount->getStep(i).value};
+            }
+            discountRecords.push_back(record);
+        }
+    }
+    builder.addSection(Products, productRecords);
+    builder.addSection(Discounts, discountRecords);
+
+    const std::map<int, Customer*>& customers = customerManager.getAllCustomers();
+    std::vector<CustomerRecord> customerRecords;
+    customerRecords.reserve(customers.size());
+    std::vector<PurchaseRecord> purchaseRecords;
+    for (const auto& [customer_id, customer] : customers) {
+        StringRef name = builder.addString(customer->getName());
+        customerRecords.push_back(CustomerRecord{customer_id, 0, name, builder.addString(customer->getEmail())});
+        if (std::optional<PurchaseHistory::View> history = customerManager.findPurchaseHistory(customer_id)) {
+            for (const PurchaseHistory::Purchase& purchase : *history) {
+                // Purchases keep their product ID; names come from the manager's product table and are stored once each
+                purchaseRecords.push_back(PurchaseRecord{customer_id, purchase.product_id, purchase.quantity, 0, purchase.total_cost,
+                                                         builder.addSharedString(purchase.product_name)});
+            }
+        }
+    }
+    builder.addSection(Customers, customerRecords);
+    builder.addSection(Purchases, purchaseRecords);
+
+    const std::vector<char>& image = builder.finish();
+    std::string temporaryPath = path + ".tmp";
+    try {
+        MappedFile file(temporaryPath, MappedFile::Mode::ReadWrite);
+        file.resize(image.size());
+        std::memcpy(file.data(), image.data(), image.size());
+        file.sync(0, image.size());
+    } catch (...) {
+        std::remove(temporaryPath.c_str());
+        throw;
+    }
+    if (std::rename(temporaryPath.c_str(), path.c_str()) != 0) {
+        std::remove(temporaryPath.c_str());
+        throw std::runtime_error("Cannot replace store snapshot: " + path);
+    }
+    syncDirectoryOf(path);
+}
+
+// Load a snapshot into empty managers
+void StoreSnapshot::load(const std::string& path, ProductManager& productManager, CustomerManager& customerManager) {
+    MappedFile file(path, MappedFile::Mode::ReadOnly);
+    ImageReader reader(path, file);
+
+    for (const CategoryRecord& record : reader.section<CategoryRecord>(Categories)) {
+        productManager.createCategory(record.category_id, reader.text(record.name));
+    }
+
+    std::span<const ProductRecord> products = reader.section<ProductRecord>(Products);
+    productManager.reserve(products.size());
+    for (const ProductRecord& record : products) {
+        Category* category = nullptr;
+        if (record.hasCategory != 0 && (category = productManager.findCategory(record.category_id)) == nullptr) {
+            reader.fail("Store snapshot product refers to a missing category");
+        }
+        productManager.emplaceProduct(record.product_id, reader.text(record.name), record.price, record.quantity, category);
+    }
+
+    for (const DiscountRecord& record : reader.section<DiscountRecord>(Discounts)) {
+        if (record.stepCount == 0 || record.stepCount > Discount::kMaxSteps) {
+            reader.fail("Damaged store snapshot discount");
+        }
+        auto ruleOf = [&reader](const DiscountRecord::Step& step) {
+            if (step.rule > static_cast<std::uint32_t>(Discount::Rule::Invalid)) {
+                reader.fail("Damaged store snapshot discount");
+            }
+            return static_cast<Discount::Rule>(step.rule);
+        };
+        Discount discount(ruleOf(record.steps[0]), record.steps[0].value);
+        for (std::uint32_t i = 1; i < record.stepCount; ++i) {
+            discount.then(ruleOf(record.steps[i]), record.steps[i].value);
+        }
+        productManager.setDiscount(record.product_id, discount);
+    }
+
+    for (const CustomerRecord& record : reader.section<CustomerRecord>(Customers)) {
+        customerManager.emplaceCustomer(record.customer_id, reader.text(record.name), reader.text(record.email));
+    }
+
+    for (const PurchaseRecord& record : reader.section<PurchaseRecord>(Purchases)) {
+        customerManager.addPurchase(record.customer_id, record.product_id, reader.text(record.product_name), record.quantity, record.total_cost);
+    }
+}
@@ -0,0 +1,93 @@
+
+
+#ifndef STORE_SNAPSHOT_H
+#define STORE_SNAPSHOT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "ProductManager.h"
+#include "CustomerManager.h"
+
+// Versioned binary image of the whole store: categories, products (with stock), discounts,
+// customers and purchase histories.
+// Every section is an array of fixed-size records, with all text in one shared string section
+// that records point into, so loading is a walk over the memory-mapped file with no text
+// parsing. Snapshots are written to a temporary file, synced and renamed over the target, so
+// a reader sees either the old snapshot or the complete new one.
+class StoreSnapshot {
+public:
+    static constexpr std::uint32_t kVersion = 2;
+
+    // Write a snapshot of the managers' state
+    static void write(const std::string& path, const ProductManager& productManager, const CustomerManager& customerManager);
+
+    // Load a snapshot into empty managers. Throws std::runtime_error if the file is not a
+    // snapshot of this version or is damaged.
+    static void load(const std::string& path, ProductManager& productManager, CustomerManager& customerManager);
+
+    // File layout
+    struct StringRef {
+        std::uint64_t offset; // Into the string section
+        std::uint64_t length;
+    };
+
+    struct Section {
+        std::uint64_t offset; // From the start of the file
+        std::uint64_t count;  // Records (bytes for the string section)
+    };
+
+    enum SectionIndex { Strings, Categories, Products, Discounts, Customers, Purchases, kSectionCount };
+
+    struct Header {
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t sectionCount;
+        std::uint64_t fileSize;
+        Section sections[kSectionCount];
+    };
+
+    struct CategoryRecord {
+        std::int32_t category_id;
+        std::uint32_t reserved;
+        StringRef name;
+    };
+
+    struct ProductRecord {
+        std::int32_t product_id;
+        std::int32_t quantity;
+        double price;
+        std::int32_t category_id;
+        std::uint32_t hasCategory;
+        StringRef name;
+    };
+
+    struct DiscountRecord {
+        struct Step {
+            std::uint32_t rule; // Discount::Rule
+            std::uint32_t reserved;
+            double value;
+        };
+        std::int32_t product_id;
+        std::uint32_t stepCount;
+        Step steps[Discount::kMaxSteps];
+    };
+
+    struct CustomerRecord {
+        std::int32_t customer_id;
+        std::uint32_t reserved;
+        StringRef name;
+        StringRef email;
+    };
+
+    struct PurchaseRecord {
+        std::int32_t customer_id;
+        std::int32_t product_id;
+        std::int32_t quantity;
+        std::uint32_t reserved;
+        double total_cost;
+        StringRef product_name;
+    };
+};
+
+#endif // STORE_SNAPSHOT_H
@@ -0,0 +1,94 @@
+
+
+#include "StringPool.h"
+#include <bit>
+#include <cstring>
+#include <mutex>
+
+// StringPool Class: Deduplicates strings that are repeated across many records
+// Adheres to SRP: Only stores and looks up text; callers decide what gets interned.
+
+// Return the ID of text, storing it if needed
+StringPool::Id StringPool::intern(std::string_view text) {
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        auto it = ids.find(text);
+        if (it != ids.end()) {
+            return it->second;
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    auto it = ids.find(text); // Another thread may have added it in between
+    if (it != ids.end()) {
+        return it->second;
+    }
+    std::string_view stored = store(text);
+    Id id = static_cast<Id>(count.load(std::memory_order_relaxed));
+    publish(id, stored);
+    ids.emplace(stored, id);
+    return id;
+}
+
+// Text for an ID, without the lock: segments never move once published
+std::string_view StringPool::view(Id id) const {
+    auto [segment, offset] = locate(id);
+    return segments[segment].load(std::memory_order_acquire)[offset];
+}
+
+// Number of distinct strings
+std::size_t StringPool::size() const {
+    return count.load(std::memory_order_acquire);
+}
+
+// Bytes held by the pool
+std::size_t StringPool::bytes() const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    return blockBytes + segmentBytes;
+}
+
+// Enter the text for a new ID, allocating its segment if needed (caller holds the exclusive lock)
+void StringPool::publish(Id id, std::string_view text) {
+    auto [segment, offset] = locate(id);
+    std::string_view* entries = segments[segment].load(std::memory_order_relaxed);
+    if (entries == nullptr) {
+        std::size_t length = std::size_t{1} << (segment + kFirstSegmentBits);
+        segmentStorage.push_back(std::make_unique<std::string_view[]>(length));
+        segmentBytes += length * sizeof(std::string_view);
+        entries = segmentStorage.back().get();
+    }
+    entries[offset] = text;
+    segments[segment].store(entries, std::memory_order_release); // Publishes the entry with the segment
+    count.store(std::size_t{id} + 1, std::memory_order_release);
+}
+
+// Segment and offset of an ID
+std::pair<std::size_t, std::size_t> StringPool::locate(Id id) {
+    std::uint64_t position = std::uint64_t{id} + (std::uint64_t{1} << kFirstSegmentBits);
+    std::size_t segment = static_cast<std::size_t>(std::bit_width(position)) - 1 - kFirstSegmentBits;
+    std::uint64_t offset = position - (std::uint64_t{1} << (segment + kFirstSegmentBits));
+    return {segment, static_cast<std::size_t>(offset)};
+}
+
+// Copy text into block storage (caller holds the exclusive lock)
+std::string_view StringPool::store(std::string_view text) {
+    if (text.empty()) {
+        return std::string_view();
+    }
+    if (text.size() > kBlockSize / 4) {
+        // Long strings get their own allocation so they do not waste the current block
+        largeStrings.push_back(std::make_unique<char[]>(text.size()));
+        std::memcpy(largeStrings.back().get(), text.data(), text.size());
+        blockBytes += text.size();
+        return std::string_view(largeStrings.back().get(), text.size());
+    }
+    if (kBlockSize - blockUsed < text.size()) {
+        blocks.push_back(std::make_unique<char[]>(kBlockSize));
+        blockUsed = 0;
+        blockBytes += kBlockSize;
+    }
+    char* destination = blocks.back().get() + blockUsed;
+    std::memcpy(destination, text.data(), text.size());
+    blockUsed += text.size();
+    return std::string_view(destination, text.size());
+}
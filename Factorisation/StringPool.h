@@ -0,0 +1,62 @@
+
+
+#ifndef STRING_POOL_H
+#define STRING_POOL_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <shared_mutex>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Interning table: each distinct string is stored once and identified by a small integer.
+// Stored text never moves, so views returned by view() stay valid for the pool's lifetime.
+// All members are thread-safe; view() takes no lock, so resolving IDs in bulk costs a load each.
+class StringPool {
+public:
+    using Id = std::uint32_t;
+
+    // Return the ID of text, storing it if it has not been seen before
+    Id intern(std::string_view text);
+
+    // Text for an ID returned by intern() (lock-free; the ID must have reached the caller
+    // through the thread that interned it or other synchronisation, as any value would)
+    std::string_view view(Id id) const;
+
+    // Number of distinct strings
+    std::size_t size() const;
+
+    // Bytes held by the pool (text blocks and the ID table, excluding the lookup index)
+    std::size_t bytes() const;
+
+private:
+    static constexpr std::size_t kBlockSize = 64 * 1024;
+
+    // The ID table is split into segments that never move once allocated: segment s holds
+    // 1024 << s entries, so 23 segments cover every Id and a reader only needs the segment
+    // pointer, not the lock that guards growth
+    static constexpr std::size_t kFirstSegmentBits = 10;
+    static constexpr std::size_t kSegmentCount = 33 - kFirstSegmentBits;
+
+    mutable std::shared_mutex mutex;
+    std::vector<std::unique_ptr<char[]>> blocks;          // Text storage
+    std::vector<std::unique_ptr<char[]>> largeStrings;    // Strings too long to share a block
+    std::size_t blockUsed = kBlockSize;                   // Bytes used in the last block
+    std::size_t blockBytes = 0;                           // Total bytes allocated for text
+    std::array<std::atomic<std::string_view*>, kSegmentCount> segments{}; // ID -> text
+    std::vector<std::unique_ptr<std::string_view[]>> segmentStorage;       // Owns the segments
+    std::size_t segmentBytes = 0;                         // Bytes allocated for segments
+    std::atomic<std::size_t> count{0};                    // Number of IDs handed out
+    std::unordered_map<std::string_view, Id> ids;         // Text -> ID
+
+    std::string_view store(std::string_view text);
+    void publish(Id id, std::string_view text);
+    static std::pair<std::size_t, std::size_t> locate(Id id);
+};
+
+#endif // STRING_POOL_H
@@ -0,0 +1,54 @@
+
+
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Fixed set of worker threads running submitted tasks in FIFO order
+class ThreadPool {
+public:
+    // Zero threads means one per hardware thread
+    explicit ThreadPool(std::size_t threadCount = 0);
+    ~ThreadPool(); // Finishes queued tasks, then joins the workers
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Queue a task; the future yields its result or rethrows its exception
+    template <typename Task>
+    std::future<std::invoke_result_t<Task>> submit(Task&& task) {
+        using Result = std::invoke_result_t<Task>;
+        auto packaged = std::make_shared<std::packaged_task<Result()>>(std::forward<Task>(task));
+        std::future<Result> result = packaged->get_future();
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            tasks.emplace_back([packaged] { (*packaged)(); });
+        }
+        available.notify_one();
+        return result;
+    }
+
+    std::size_t size() const;
+
+private:
+    std::vector<std::thread> workers;
+    std::deque<std::function<void()>> tasks;
+    std::mutex mutex;
+    std::condition_variable available;
+    bool stopping = false;
+
+    void run();
+};
+
+#endif // THREAD_POOL_H
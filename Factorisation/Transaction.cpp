@@ -1,46 +1,277 @@
 
 #include "Transaction.h"
 #include <stdexcept>
-#include <iostream>
+#include <algorithm> // For std::sort, std::unique, std::lower_bound
+#include <string>
+#include "FormatUtils.h"
+#include "Instrumentation.h"
 
-// Constructor
+namespace {
+
+ConsoleReceiptSink consoleSink; // Default destination, matching the original console output
+
+// Per-thread text buffer, cleared and reused for every purchase so rendering does not allocate
+std::string& renderBuffer() {
+    thread_local std::string buffer;
+    buffer.clear();
+    return buffer;
+}
+
+// Stock taken for one purchase, given back on destruction unless the purchase was recorded
+class StockReservation {
+public:
+    StockReservation(Product* product, int quantity) : product(product), quantity(quantity) {}
+    StockReservation(const StockReservation&) = delete;
+    StockReservation& operator=(const StockReservation&) = delete;
+    ~StockReservation() {
+        if (product != nullptr) {
+            product->release(quantity);
+        }
+    }
+
+    void commit() { product = nullptr; }
+
+private:
+    Product* product;
+    int quantity;
+};
+
+// Stock taken for the lines of one batch order, line by line; everything taken is given back
+// on destruction unless the order was recorded
+class OrderReservation {
+public:
+    OrderReservation(const std::vector<Product*>& products, const std::vector<std::size_t>& lineProducts,
+                     const std::vector<OrderLine>& lines)
+        : products(products), lineProducts(lineProducts), lines(lines) {}
+    OrderReservation(const OrderReservation&) = delete;
+    OrderReservation& operator=(const OrderReservation&) = delete;
+    ~OrderReservation() { release(); }
+
+    // Reserve every line; false (having taken nothing) if one falls short
+    bool reserveAll() {
+        while (reserved < lines.size()) {
+            if (!products[lineProducts[reserved]]->tryReserve(lines[reserved].quantity)) {
+                release();
+                return false;
+            }
+            ++reserved;
+        }
+        return true;
+    }
+
+    void commit() { reserved = 0; }
+
+private:
+    const std::vector<Product*>& products;
+    const std::vector<std::size_t>& lineProducts;
+    const std::vector<OrderLine>& lines;
+    std::size_t reserved = 0;
+
+    void release() {
+        for (std::size_t i = 0; i < reserved; ++i) {
+            products[lineProducts[i]]->release(lines[i].quantity);
+        }
+        reserved = 0;
+    }
+};
+
+} // namespace
+
+// Constructors
 Transaction::Transaction(ProductManager& pm, CustomerManager& cm, const ReceiptFormat& rf)
-    : productManager(pm), customerManager(cm), receiptFormat(rf) {}
+    : productManager(pm), customerManager(cm), receiptFormat(rf), receiptSink(consoleSink) {}
+
+Transaction::Transaction(ProductManager& pm, CustomerManager& cm, const ReceiptFormat& rf, ReceiptSink& sink)
+    : productManager(pm), customerManager(cm), receiptFormat(rf), receiptSink(sink) {}
 
 // Process a purchase
 void Transaction::processPurchase(int customer_id, int product_id, int quantity) {
+    FACTORISATION_TIME_SCOPE(purchaseTimer, Stage::Purchase);
+    CommittedPurchase committed;
+    if (!commitPurchase(customer_id, product_id, quantity, committed)) {
+        throw std::invalid_argument("Insufficient product quantity.");
+    }
+    Customer* customer = committed.customer;
+    Product* product = committed.product;
+    double discountedPrice = committed.discountedPrice;
+    double totalCost = committed.totalCost;
+
+    // More descriptive output, rendered into a reused per-thread buffer and handed to the sink in one piece
+    FACTORISATION_PHASES(phases);
+    std::string& details = renderBuffer();
+    details += "\nTransaction Details:\n  Customer: ";
+    details += customer->getName();
+    details += " (ID: ";
+    appendInteger(details, customer_id);
+    details += ")\n  Product: ";
+    details += product->getName();
+    details += " (ID: ";
+    appendInteger(details, product_id);
+    details += ")\n  Original Price: $";
+    appendFixed2(details, product->getPrice());
+    details += "\n  Discounted Price: $";
+    appendFixed2(details, discountedPrice);
+    details += "\n  Quantity: ";
+    appendInteger(details, quantity);
+    details += "\n  Total Cost: $";
+    appendFixed2(details, totalCost);
+    details += "\n";
+
+    receiptFormat.renderReceipt(details, customer->getName(), product->getName(), quantity, totalCost);
+    receiptSink.write(details);
+    FACTORISATION_PHASE(phases, Stage::PurchaseReceipt);
+}
+
+// Wait for queued receipts
+void Transaction::flushReceipts() {
+    receiptSink.flush();
+}
+
+// Charge prices from a precomputed table
+void Transaction::setPriceTable(const PriceTable* prices) {
+    priceTable = prices;
+}
+
+// Discounted price for a product known to exist
+double Transaction::priceOf(int product_id) const {
+    if (priceTable != nullptr) {
+        if (std::optional<double> price = priceTable->find(product_id)) {
+            return *price;
+        }
+    }
+    return *productManager.findDiscountPrice(product_id);
+}
+
+// Record committed purchases in a journal
+void Transaction::setJournal(TransactionJournal* purchaseJournal) {
+    journal = purchaseJournal;
+}
+
+// Process a purchase from a worker thread
+bool Transaction::tryPurchase(int customer_id, int product_id, int quantity) {
+    CommittedPurchase committed;
+    return commitPurchase(customer_id, product_id, quantity, committed);
+}
+
+// Validate, reserve stock and record the purchase
+bool Transaction::commitPurchase(int customer_id, int product_id, int quantity, CommittedPurchase& committed) {
     if (quantity <= 0) {
         throw std::invalid_argument("Quantity must be greater than zero.");
     }
 
-    Product* product = productManager.getProduct(product_id);
+    FACTORISATION_PHASES(phases);
+    Product* product = productManager.findProduct(product_id);
     if (product == nullptr) {
-        throw std::invalid_argument("Product not found.");
+        throw std::invalid_argument("Product not found with ID: " + std::to_string(product_id));
     }
 
-    Customer* customer = customerManager.getCustomer(customer_id);
+    Customer* customer = customerManager.findCustomer(customer_id);
     if (customer == nullptr) {
         throw std::invalid_argument("Customer not found.");
     }
+    FACTORISATION_PHASE(phases, Stage::PurchaseLookup);
 
-    if (quantity > product->getQuantity()) {
-        throw std::invalid_argument("Insufficient product quantity.");
+    // Price first: a failing discount must not leave stock reserved
+    double discountedPrice = priceOf(product_id);
+    double totalCost = discountedPrice * quantity;
+    FACTORISATION_PHASE(phases, Stage::PurchaseDiscount);
+
+    // Check and decrement in one atomic step so concurrent buyers cannot oversell
+    if (!product->tryReserve(quantity)) {
+        return false;
     }
+    StockReservation reservation(product, quantity); // Returns the stock if recording throws
+    FACTORISATION_PHASE(phases, Stage::PurchaseStock);
 
-    double discountedPrice = productManager.getDiscountPrice(product_id);
-    double totalCost = discountedPrice * quantity;
+    customerManager.addPurchase(customer_id, product_id, product->getName(), quantity, totalCost);
+    if (journal != nullptr) {
+        journal->append(customer_id, product_id, quantity, totalCost);
+    }
+    reservation.commit();
+    FACTORISATION_PHASE(phases, Stage::PurchaseHistory);
+
+    committed = CommittedPurchase{customer, product, discountedPrice, totalCost};
+    return true;
+}
+
+// Process a batch of orders
+BatchResult Transaction::processBatch(std::span<const Order> orders) {
+    // Group the batch by customer and by product so each is resolved only once
+    std::vector<int> customerIds;
+    std::vector<int> productIds;
+    customerIds.reserve(orders.size());
+    for (const Order& order : orders) {
+        customerIds.push_back(order.customer_id);
+        for (const OrderLine& line : order.lines) {
+            productIds.push_back(line.product_id);
+        }
+    }
+    std::sort(customerIds.begin(), customerIds.end());
+    customerIds.erase(std::unique(customerIds.begin(), customerIds.end()), customerIds.end());
+    std::sort(productIds.begin(), productIds.end());
+    productIds.erase(std::unique(productIds.begin(), productIds.end()), productIds.end());
+
+    // Resolved entities, parallel to the sorted ID lists (nullptr for unknown IDs, and for
+    // products whose discount cannot be applied, so only their orders are rejected)
+    std::vector<Customer*> customers(customerIds.size(), nullptr);
+    for (std::size_t i = 0; i < customerIds.size(); ++i) {
+        customers[i] = customerManager.findCustomer(customerIds[i]);
+    }
+    std::vector<Product*> products(productIds.size(), nullptr);
+    std::vector<double> discountedPrices(productIds.size(), 0.0);
+    for (std::size_t i = 0; i < productIds.size(); ++i) {
+        products[i] = productManager.findProduct(productIds[i]);
+        if (products[i] != nullptr) {
+            try {
+                discountedPrices[i] = priceOf(productIds[i]);
+            } catch (const std::invalid_argument&) {
+                products[i] = nullptr; // Invalid discount type
+            }
+        }
+    }
+    auto indexOf = [](const std::vector<int>& ids, int id) {
+        return static_cast<std::size_t>(std::lower_bound(ids.begin(), ids.end(), id) - ids.begin());
+    };
+
+    BatchResult result;
+    std::string& receipts = renderBuffer();
+    std::vector<std::size_t> lineProducts; // Resolved product index of each line in the current order
 
-    product->updateQuantity(product->getQuantity() - quantity);
-    customerManager.addPurchase(customer_id, product->getName(), quantity, totalCost);
+    for (std::size_t orderIndex = 0; orderIndex < orders.size(); ++orderIndex) {
+        const Order& order = orders[orderIndex];
+        Customer* customer = customers[indexOf(customerIds, order.customer_id)];
 
-    // More descriptive output
-    std::cout << "\nTransaction Details:\n";
-    std::cout << "  Customer: " << customer->getName() << " (ID: " << customer_id << ")\n";
-    std::cout << "  Product: " << product->getName() << " (ID: " << product_id << ")\n";
-    std::cout << "  Original Price: $" << std::fixed << std::setprecision(2) << product->getPrice() << "\n"; // Use product->getPrice()
-    std::cout << "  Discounted Price: $" << std::fixed << std::setprecision(2) << discountedPrice << "\n";
-    std::cout << "  Quantity: " << quantity << "\n";
-    std::cout << "  Total Cost: $" << std::fixed << std::setprecision(2) << totalCost << "\n";
+        // Validate every line before touching any stock
+        bool valid = customer != nullptr && !order.lines.empty();
+        lineProducts.clear();
+        for (const OrderLine& line : order.lines) {
+            std::size_t productIndex = indexOf(productIds, line.product_id);
+            valid = valid && line.quantity > 0 && products[productIndex] != nullptr;
+            lineProducts.push_back(productIndex);
+        }
+
+        // Reserve all lines, or none if any line falls short; the stock goes back if
+        // recording the order throws
+        OrderReservation reservation(products, lineProducts, order.lines);
+        if (!valid || !reservation.reserveAll()) {
+            result.rejectedOrders.push_back(orderIndex);
+            continue;
+        }
+
+        for (std::size_t i = 0; i < order.lines.size(); ++i) {
+            Product* product = products[lineProducts[i]];
+            int quantity = order.lines[i].quantity;
+            double totalCost = discountedPrices[lineProducts[i]] * quantity;
+            customerManager.addPurchase(order.customer_id, product->getProductId(), product->getName(), quantity, totalCost);
+            if (journal != nullptr) {
+                journal->append(order.customer_id, product->getProductId(), quantity, totalCost);
+            }
+            receiptFormat.renderReceipt(receipts, customer->getName(), product->getName(), quantity, totalCost);
+        }
+        reservation.commit();
+        ++result.ordersCommitted;
+    }
 
-    std::cout << receiptFormat.generateReceipt(customer->getName(), product->getName(), quantity, totalCost);
+    receiptSink.write(receipts);
+    return result;
 }
@@ -6,16 +6,79 @@
 #include "ProductManager.h"
 #include "CustomerManager.h"
 #include "ReceiptFormat.h"
+#include "ReceiptSink.h"
+#include "TransactionJournal.h"
+#include "PriceTable.h"
+#include <cstddef>
+#include <span>
+#include <vector>
+
+// One line item of an order
+struct OrderLine {
+    int product_id;
+    int quantity;
+};
+
+// A customer's order; its lines are purchased together or not at all
+struct Order {
+    int customer_id;
+    std::vector<OrderLine> lines;
+};
+
+// Outcome of Transaction::processBatch
+struct BatchResult {
+    std::size_t ordersCommitted = 0;
+    std::vector<std::size_t> rejectedOrders; // Indices of orders that were not purchased
+};
 
 class Transaction {
 private:
     ProductManager& productManager;
     CustomerManager& customerManager;
     const ReceiptFormat& receiptFormat;
+    ReceiptSink& receiptSink; // Where transaction details and receipts are written
+    TransactionJournal* journal = nullptr; // Optional durable record of committed purchases
+    const PriceTable* priceTable = nullptr; // Optional precomputed prices (e.g. a promotion)
+
+    // Discounted price from the price table when it has the product, else from the product manager
+    double priceOf(int product_id) const;
+
+    // State changed by a committed purchase
+    struct CommittedPurchase {
+        Customer* customer;
+        Product* product;
+        double discountedPrice;
+        double totalCost;
+    };
+
+    // Validate, reserve stock and record the purchase; returns false if stock ran out
+    bool commitPurchase(int customer_id, int product_id, int quantity, CommittedPurchase& committed);
 
 public:
-    Transaction(ProductManager& pm, CustomerManager& cm, const ReceiptFormat& rf);
+    Transaction(ProductManager& pm, CustomerManager& cm, const ReceiptFormat& rf); // Writes to std::cout
+    Transaction(ProductManager& pm, CustomerManager& cm, const ReceiptFormat& rf, ReceiptSink& sink);
     void processPurchase(int customer_id, int product_id, int quantity);
+
+    // Wait until every receipt written so far has reached its destination
+    void flushReceipts();
+
+    // Record every committed purchase in a journal (nullptr to stop journaling)
+    void setJournal(TransactionJournal* purchaseJournal);
+
+    // Charge prices from a bulk-computed table, e.g. ProductManager::repriceAll during a
+    // promotion (nullptr to go back to per-product discounts)
+    void setPriceTable(const PriceTable* prices);
+
+    // Thread-safe purchase without console output: many worker threads may call this at once.
+    // Returns false if there was not enough stock; throws for unknown IDs or invalid quantity.
+    bool tryPurchase(int customer_id, int product_id, int quantity);
+
+    // Purchase a batch of orders. Each distinct customer and product is looked up (and each
+    // discount applied) once per batch; each order reserves stock for all of its lines or
+    // none of them. Orders with unknown IDs, invalid quantities or insufficient stock are
+    // rejected without affecting the rest of the batch. Receipts for committed orders are
+    // written in a single pass at the end.
+    BatchResult processBatch(std::span<const Order> orders);
 };
 
 #endif // TRANSACTION_H
@@ -0,0 +1,144 @@
+
+
+#include "TransactionJournal.h"
+#include <cstring>
+#include <stdexcept>
+
+// TransactionJournal Class: Persists committed purchases
+// Adheres to SRP: Only records and replays purchases; pricing and stock rules stay in Transaction.
+
+namespace {
+
+constexpr char kMagic[8] = {'S', 'O', 'L', 'I', 'D', 'J', 'N', 'L'};
+constexpr std::uint32_t kVersion = 1;
+
+} // namespace
+
+// Open an existing journal or start a new one
+TransactionJournal::TransactionJournal(const std::string& path, std::size_t groupCommitRecords)
+    : file(path, MappedFile::Mode::ReadWrite), groupCommitRecords(groupCommitRecords == 0 ? 1 : groupCommitRecords) {
+    static_assert(sizeof(Header) <= kHeaderSize, "Journal header must fit in its reserved space");
+
+    if (file.size() == 0) {
+        file.resize(kHeaderSize + kGrowthRecords * sizeof(Record));
+        Header* fresh = header();
+        std::memcpy(fresh->magic, kMagic, sizeof(kMagic));
+        fresh->version = kVersion;
+        fresh->recordSize = sizeof(Record);
+        fresh->committedRecords = 0;
+        file.sync(0, kHeaderSize);
+        return;
+    }
+
+    const Header* existing = header();
+    if (file.size() < kHeaderSize || std::memcmp(existing->magic, kMagic, sizeof(kMagic)) != 0) {
+        throw std::runtime_error("Not a transaction journal: " + path);
+    }
+    if (existing->version != kVersion || existing->recordSize != sizeof(Record)) {
+        throw std::runtime_error("Unsupported transaction journal version: " + path);
+    }
+
+    // Anything written after the last group commit is discarded
+    std::size_t capacity = (file.size() - kHeaderSize) / sizeof(Record);
+    committed = static_cast<std::size_t>(existing->committedRecords);
+    if (committed > capacity) {
+        committed = capacity;
+    }
+    appended = committed;
+}
+
+TransactionJournal::~TransactionJournal() {
+    try {
+        commit();
+    } catch (...) {
+        // Destructors must not throw; uncommitted records are dropped as after a crash
+    }
+}
+
+// Append a purchase
+void TransactionJournal::append(int customer_id, int product_id, int quantity, double total_cost) {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::size_t capacity = (file.size() - kHeaderSize) / sizeof(Record);
+    if (appended == capacity) {
+        file.resize(kHeaderSize + (capacity + kGrowthRecords) * sizeof(Record));
+    }
+
+    Record record{customer_id, product_id, quantity, 0, total_cost};
+    record.checksum = checksumOf(record);
+    records()[appended++] = record;
+
+    if (appended - committed >= groupCommitRecords) {
+        commitLocked();
+    }
+}
+
+// Make every appended record durable
+void TransactionJournal::commit() {
+    std::lock_guard<std::mutex> lock(mutex);
+    commitLocked();
+}
+
+// Number of durable records
+std::size_t TransactionJournal::committedRecords() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return committed;
+}
+
+// Re-apply every durable record
+std::size_t TransactionJournal::replay(ProductManager& productManager, CustomerManager& customerManager) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    const Record* journal = records();
+    for (std::size_t i = 0; i < committed; ++i) {
+        const Record& record = journal[i];
+        if (record.checksum != checksumOf(record)) {
+            throw std::runtime_error("Corrupt transaction journal record " + std::to_string(i));
+        }
+        Product* product = productManager.findProduct(record.product_id);
+        if (product == nullptr) {
+            throw std::runtime_error("Transaction journal refers to unknown product " + std::to_string(record.product_id));
+        }
+        if (!product->tryReserve(record.quantity)) {
+            throw std::runtime_error("Transaction journal exceeds stock of product " + std::to_string(record.product_id));
+        }
+        customerManager.addPurchase(record.customer_id, record.product_id, product->getName(), record.quantity, record.total_cost);
+    }
+    return committed;
+}
+
+// Sync the new records first and only then count them, so a crash never exposes a torn record
+void TransactionJournal::commitLocked() {
+    if (appended == committed) {
+        return;
+    }
+    file.sync(kHeaderSize + committed * sizeof(Record), (appended - committed) * sizeof(Record));
+    header()->committedRecords = appended;
+    file.sync(0, kHeaderSize);
+    committed = appended;
+}
+
+TransactionJournal::Header* TransactionJournal::header() {
+    return reinterpret_cast<Header*>(file.data());
+}
+
+TransactionJournal::Record* TransactionJournal::records() {
+    return reinterpret_cast<Record*>(file.data() + kHeaderSize);
+}
+
+const TransactionJournal::Record* TransactionJournal::records() const {
+    return reinterpret_cast<const Record*>(file.data() + kHeaderSize);
+}
+
+// FNV-1a over the record fields
+std::uint32_t TransactionJournal::checksumOf(const Record& record) {
+    unsigned char bytes[sizeof(std::int32_t) * 3 + sizeof(double)];
+    std::memcpy(bytes, &record.customer_id, sizeof(std::int32_t));
+    std::memcpy(bytes + 4, &record.product_id, sizeof(std::int32_t));
+    std::memcpy(bytes + 8, &record.quantity, sizeof(std::int32_t));
+    std::memcpy(bytes + 12, &record.total_cost, sizeof(double));
+
+    std::uint32_t hash = 2166136261u;
+    for (unsigned char byte : bytes) {
+        hash = (hash ^ byte) * 16777619u;
+    }
+    return hash;
+}
@@ -0,0 +1,74 @@
+
+
+#ifndef TRANSACTION_JOURNAL_H
+#define TRANSACTION_JOURNAL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include "MappedFile.h"
+#include "ProductManager.h"
+#include "CustomerManager.h"
+
+// Binary, append-only journal of committed purchases, written through a memory mapping.
+// Records become durable in groups: every groupCommitRecords appends (or on commit()), the
+// new records are synced to disk and only then counted in the header. After a crash, records
+// past the last group commit are ignored, so the journal always replays a consistent prefix.
+class TransactionJournal {
+public:
+    struct Record {
+        std::int32_t customer_id;
+        std::int32_t product_id;
+        std::int32_t quantity;
+        std::uint32_t checksum;
+        double total_cost;
+    };
+
+    explicit TransactionJournal(const std::string& path, std::size_t groupCommitRecords = 4096);
+    ~TransactionJournal(); // Commits outstanding records
+
+    TransactionJournal(const TransactionJournal&) = delete;
+    TransactionJournal& operator=(const TransactionJournal&) = delete;
+
+    // Append a purchase (thread-safe)
+    void append(int customer_id, int product_id, int quantity, double total_cost);
+
+    // Make every appended record durable
+    void commit();
+
+    // Number of durable records
+    std::size_t committedRecords() const;
+
+    // Re-apply every durable record: take the stock out of the product and add the purchase to
+    // the customer's history. The managers must hold the catalog and customers as they were when
+    // the journal was started. Returns the number of records applied. The demo program does this
+    // at startup when run with --journal (Program::recoverFromJournal).
+    std::size_t replay(ProductManager& productManager, CustomerManager& customerManager) const;
+
+private:
+    struct Header {
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t recordSize;
+        std::uint64_t committedRecords;
+    };
+
+    static constexpr std::size_t kHeaderSize = 64;         // Records start on their own cache line
+    static constexpr std::size_t kGrowthRecords = 1 << 16; // File grows by this many records at a time
+
+    MappedFile file;
+    std::size_t groupCommitRecords;
+    std::size_t appended = 0;  // Records written to the mapping
+    std::size_t committed = 0; // Records counted in the header
+    mutable std::mutex mutex;
+
+    Header* header();
+    Record* records();
+    const Record* records() const;
+    void commitLocked();
+
+    static std::uint32_t checksumOf(const Record& record);
+};
+
+#endif // TRANSACTION_JOURNAL_H
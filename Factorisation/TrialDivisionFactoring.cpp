@@ -0,0 +1,24 @@
+
+
+#include "TrialDivisionFactoring.h"
+#include "FactorKernels.h"
+#include "FactorizationBatch.h"
+
+// TrialDivisionFactoring Class: Factors by dividing out candidate primes in turn
+// Adheres to LSP: Usable anywhere a FactoringMethod is expected.
+
+std::vector<std::uint64_t> TrialDivisionFactoring::factorize(std::uint64_t number) const {
+    std::vector<std::uint64_t> factors;
+    appendFactors(number, factors);
+    return factors;
+}
+
+void TrialDivisionFactoring::factorizeBatch(std::span<const std::uint64_t> numbers, FactorizationBatch& out, ThreadPool* pool) const {
+    factorizeInParallel(numbers, out, pool, [this](std::uint64_t number, std::vector<std::uint64_t>& factors) {
+        appendFactors(number, factors);
+    });
+}
+
+void TrialDivisionFactoring::appendFactors(std::uint64_t number, std::vector<std::uint64_t>& factors) const {
+    trialDivisionFactors(number, factors);
+}
@@ -0,0 +1,20 @@
+
+
+#ifndef TRIAL_DIVISION_FACTORING_H
+#define TRIAL_DIVISION_FACTORING_H
+
+#include "FactoringMethod.h"
+
+// Trial division by 2, 3 and 5 followed by a mod-30 wheel. Needs no memory and is the fastest
+// engine for small numbers, but its cost grows with the square root of the largest prime factor.
+class TrialDivisionFactoring : public FactoringMethod {
+public:
+    using FactoringMethod::factorize;
+    std::vector<std::uint64_t> factorize(std::uint64_t number) const override;
+    void factorizeBatch(std::span<const std::uint64_t> numbers, FactorizationBatch& out, ThreadPool* pool = nullptr) const override;
+
+    // Append the factors of number to factors (non-virtual; used by the batch API)
+    void appendFactors(std::uint64_t number, std::vector<std::uint64_t>& factors) const;
+};
+
+#endif // TRIAL_DIVISION_FACTORING_H
@@ -0,0 +1,95 @@
+// BatchCheckoutBenchmark.cpp
+// Compares Transaction::processPurchase called once per line item against
+// Transaction::processBatch over the same order feed. Console output is discarded.
+// Usage: BatchCheckoutBenchmark [lineItems] [linesPerOrder]
+#include "Benchmark.h"
+#include "../ProductManager.h"
+#include "../CustomerManager.h"
+#include "../ReceiptFormat.h"
+#include "../Transaction.h"
+#include <random>
+#include <streambuf>
+#include <vector>
+
+namespace {
+
+constexpr int kProducts = 10000;
+constexpr int kCustomers = 1000;
+
+// Stream buffer that throws everything away
+class NullBuffer : public std::streambuf {
+protected:
+    int overflow(int c) override { return c; }
+    std::streamsize xsputn(const char*, std::streamsize count) override { return count; }
+};
+
+void populate(ProductManager& productManager, CustomerManager& customerManager) {
+    for (int id = 1; id <= kProducts; ++id) {
+        productManager.addProduct(Product(id, "Product " + std::to_string(id), 19.99, 1 << 30));
+        productManager.setDiscount(id, Discount(id % 2 ? "flat" : "percentage", 5.0));
+    }
+    for (int id = 1; id <= kCustomers; ++id) {
+        customerManager.addCustomer(new Customer(id, "Customer " + std::to_string(id), "customer@example.com"));
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t lineItems = benchmarkArgument(argc, argv, 1, 200000);
+    const std::size_t linesPerOrder = benchmarkArgument(argc, argv, 2, 4);
+
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> product(1, kProducts);
+    std::uniform_int_distribution<int> customer(1, kCustomers);
+    std::uniform_int_distribution<int> quantity(1, 5);
+    std::vector<Order> orders;
+    for (std::size_t i = 0; i < lineItems; i += linesPerOrder) {
+        Order order{customer(rng), {}};
+        for (std::size_t line = 0; line < linesPerOrder; ++line) {
+            order.lines.push_back(OrderLine{product(rng), quantity(rng)});
+        }
+        orders.push_back(std::move(order));
+    }
+    const std::size_t totalLines = orders.size() * linesPerOrder;
+
+    NullBuffer nullBuffer;
+    std::streambuf* console = std::cout.rdbuf(&nullBuffer);
+    double perItemSeconds = 0.0;
+    double batchSeconds = 0.0;
+
+    {
+        ProductManager productManager;
+        CustomerManager customerManager;
+        TextReceiptFormat receiptFormat;
+        Transaction transaction(productManager, customerManager, receiptFormat);
+        populate(productManager, customerManager);
+
+        BenchmarkTimer timer;
+        for (const Order& order : orders) {
+            for (const OrderLine& line : order.lines) {
+                transaction.processPurchase(order.customer_id, line.product_id, line.quantity);
+            }
+        }
+        perItemSeconds = timer.elapsedSeconds();
+    }
+
+    {
+        ProductManager productManager;
+        CustomerManager customerManager;
+        TextReceiptFormat receiptFormat;
+        Transaction transaction(productManager, customerManager, receiptFormat);
+        populate(productManager, customerManager);
+
+        BenchmarkTimer timer;
+        BatchResult result = transaction.processBatch(orders);
+        batchSeconds = timer.elapsedSeconds();
+        benchmarkKeep(result.ordersCommitted);
+    }
+
+    std::cout.rdbuf(console);
+    std::cout << totalLines << " line items in orders of " << linesPerOrder << "\n";
+    benchmarkReport("processPurchase per line item", totalLines, perItemSeconds);
+    benchmarkReport("processBatch", totalLines, batchSeconds);
+    return 0;
+}
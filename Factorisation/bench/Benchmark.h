@@ -0,0 +1,49 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+// Small helpers shared by the standalone benchmark programs in this directory.
+
+// Wall-clock stopwatch started on construction
+class BenchmarkTimer {
+public:
+    BenchmarkTimer() : start(std::chrono::steady_clock::now()) {}
+
+    double elapsedSeconds() const {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+private:
+    std::chrono::steady_clock::time_point start;
+};
+
+// Keep the optimizer from discarding a computed value
+template <typename T>
+inline void benchmarkKeep(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+// Read a size argument from the command line, falling back to a default
+inline std::size_t benchmarkArgument(int argc, char** argv, int index, std::size_t fallback) {
+    return argc > index ? static_cast<std::size_t>(std::strtoull(argv[index], nullptr, 10)) : fallback;
+}
+
+// Print one result line: name, operations per second and nanoseconds per operation
+inline void benchmarkReport(const std::string& name, std::size_t operations, double seconds) {
+    std::cout << std::left << std::setw(48) << name << std::right
+              << std::fixed << std::setprecision(0) << std::setw(16) << operations / seconds << " ops/s"
+              << std::setprecision(2) << std::setw(16) << seconds * 1e9 / operations << " ns/op\n";
+}
+
+#endif // BENCHMARK_H
@@ -0,0 +1,246 @@
+// BenchmarkSuite.cpp
+// One run over every hot path of the store on synthetic data: product lookups and pricing,
+// category queries, purchase recording and checkout, every receipt format, the purchase
+// history formatter and both reports. Customers and products in the purchase streams are
+// Zipf-distributed. Results are printed as a table and written as JSON for comparing runs;
+// in a FACTORISATION_INSTRUMENTATION build the per-stage latency statistics are included.
+// Usage: BenchmarkSuite [products] [customers] [operations] [json path, - for stdout] [zipf exponent]
+#include "Benchmark.h"
+#include "Workload.h"
+#include "../Instrumentation.h"
+#include "../InventoryReport.h"
+#include "../PlainTextPurchaseHistoryFormatter.h"
+#include "../ReceiptFormat.h"
+#include "../ReceiptSink.h"
+#include "../SalesReport.h"
+#include "../Transaction.h"
+#include <chrono>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace {
+
+struct Result {
+    std::string name;
+    std::size_t operations;
+    double seconds;
+};
+
+// Runs and records the measurements
+class Suite {
+public:
+    // Time body, which performs operations operations
+    void measure(const std::string& name, std::size_t operations, const std::function<void()>& body) {
+        BenchmarkTimer timer;
+        body();
+        double seconds = timer.elapsedSeconds();
+        benchmarkReport(name, operations, seconds);
+        results.push_back({name, operations, seconds});
+    }
+
+    void writeJson(std::ostream& out, const std::vector<std::pair<std::string, std::size_t>>& parameters, double zipfExponent) const {
+        std::time_t now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+        char timestamp[32];
+        std::strftime(timestamp, sizeof(timestamp), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+
+        out << "{\n  \"suite\": \"Factorisation\",\n  \"schema\": 1,\n  \"timestamp\": \"" << timestamp << "\",\n";
+        out << "  \"parameters\": {";
+        for (const auto& [key, value] : parameters) {
+            out << '"' << key << "\": " << value << ", ";
+        }
+        out << "\"zipf_exponent\": " << zipfExponent << "},\n  \"results\": [\n";
+        out << std::setprecision(6) << std::defaultfloat;
+        for (std::size_t i = 0; i < results.size(); ++i) {
+            const Result& result = results[i];
+            out << "    {\"name\": \"" << escaped(result.name) << "\", \"operations\": " << result.operations
+                << ", \"seconds\": " << result.seconds
+                << ", \"ns_per_op\": " << result.seconds * 1e9 / result.operations
+                << ", \"ops_per_second\": " << result.operations / result.seconds << '}'
+                << (i + 1 < results.size() ? ",\n" : "\n");
+        }
+        out << "  ]";
+        if (Instrumentation::enabled()) {
+            std::vector<StageStats> stages = Instrumentation::snapshot();
+            out << ",\n  \"stages\": [\n";
+            for (std::size_t i = 0; i < stages.size(); ++i) {
+                const StageStats& stage = stages[i];
+                out << "    {\"name\": \"" << stageName(stage.stage) << "\", \"count\": " << stage.count
+                    << ", \"mean_ns\": " << stage.meanNanoseconds << ", \"p50_ns\": " << stage.p50Nanoseconds
+                    << ", \"p99_ns\": " << stage.p99Nanoseconds << ", \"p999_ns\": " << stage.p999Nanoseconds
+                    << ", \"max_ns\": " << stage.maxNanoseconds << '}' << (i + 1 < stages.size() ? ",\n" : "\n");
+            }
+            out << "  ]";
+        }
+        out << "\n}\n";
+    }
+
+private:
+    std::vector<Result> results;
+
+    static std::string escaped(std::string_view text) {
+        std::string out;
+        for (char c : text) {
+            if (c == '"' || c == '\\') {
+                out += '\\';
+            }
+            out += c;
+        }
+        return out;
+    }
+};
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t productCount = benchmarkArgument(argc, argv, 1, 1000000);
+    const std::size_t customerCount = benchmarkArgument(argc, argv, 2, 100000);
+    const std::size_t operations = benchmarkArgument(argc, argv, 3, 1000000);
+    const std::string jsonPath = argc > 4 ? argv[4] : "BenchmarkSuite.json";
+    const double zipfExponent = argc > 5 ? std::strtod(argv[5], nullptr) : 1.0;
+    const std::size_t categoryCount = 100;
+    const int stock = 1000000000; // Enough that no purchase in the run is refused
+
+    std::mt19937_64 generator(42);
+    ProductManager productManager;
+    CustomerManager customerManager;
+    populateProducts(productManager, productCount, categoryCount, stock, generator);
+    populateCustomers(customerManager, customerCount);
+    std::vector<PurchaseEvent> stream = zipfPurchaseStream(operations, customerCount, productCount, zipfExponent, generator);
+    std::cout << productCount << " products in " << categoryCount << " categories, " << customerCount
+              << " customers, " << operations << " operations, Zipf exponent " << zipfExponent << "\n";
+
+    Suite suite;
+    std::size_t checksum = 0;
+    double priceSum = 0.0;
+
+    // Catalog
+    suite.measure("ProductManager::getProduct", stream.size(), [&] {
+        for (const PurchaseEvent& event : stream) {
+            checksum += static_cast<std::size_t>(productManager.getProduct(event.product_id)->getQuantity());
+        }
+    });
+    suite.measure("ProductManager::getDiscountPrice", stream.size(), [&] {
+        for (const PurchaseEvent& event : stream) {
+            priceSum += productManager.getDiscountPrice(event.product_id);
+        }
+    });
+    const std::size_t scans = std::max<std::size_t>(1, 20000000 / std::max<std::size_t>(1, productCount));
+    suite.measure("ProductManager::getAllProducts", scans, [&] {
+        for (std::size_t i = 0; i < scans; ++i) {
+            checksum += productManager.getAllProducts().size();
+        }
+    });
+    suite.measure("ProductManager::productsInIdOrder (full scan)", scans, [&] {
+        for (std::size_t i = 0; i < scans; ++i) {
+            for (const Product* product : productManager.productsInIdOrder()) {
+                checksum += static_cast<std::size_t>(product->getProductId());
+            }
+        }
+    });
+    const std::size_t categoryQueries = std::max<std::size_t>(1, operations / 100);
+    suite.measure("ProductManager::getProductsByCategory", categoryQueries, [&] {
+        for (std::size_t i = 0; i < categoryQueries; ++i) {
+            checksum += productManager.getProductsByCategory(static_cast<int>(i % categoryCount) + 1).size();
+        }
+    });
+    suite.measure("ProductManager::getProductsByCategory (page of 50)", stream.size(), [&] {
+        for (const PurchaseEvent& event : stream) {
+            int category = (event.product_id - 1) % static_cast<int>(categoryCount) + 1;
+            checksum += productManager.getProductsByCategory(category, static_cast<std::size_t>(event.customer_id) % 64, 50).size();
+        }
+    });
+
+    // Names are built up front so the purchase and receipt timings exclude string formatting
+    std::vector<std::string> customerNames, productNames;
+    customerNames.reserve(stream.size());
+    productNames.reserve(stream.size());
+    for (const PurchaseEvent& event : stream) {
+        customerNames.push_back("Customer " + std::to_string(event.customer_id));
+        productNames.push_back("Product " + std::to_string(event.product_id));
+    }
+
+    // Purchases
+    suite.measure("CustomerManager::addPurchase", stream.size(), [&] {
+        for (std::size_t i = 0; i < stream.size(); ++i) {
+            const PurchaseEvent& event = stream[i];
+            customerManager.addPurchase(event.customer_id, event.product_id, productNames[i], event.quantity, 9.99 * event.quantity);
+        }
+    });
+    TextReceiptFormat textFormat;
+    HTMLReceiptFormat htmlFormat;
+    const std::vector<std::pair<std::string, const ReceiptFormat*>> formats = {{"Text", &textFormat}, {"HTML", &htmlFormat}};
+    NullReceiptSink nullSink;
+    for (const auto& [formatName, format] : formats) {
+        Transaction transaction(productManager, customerManager, *format, nullSink);
+        suite.measure("Transaction::processPurchase (" + formatName + " receipt)", stream.size(), [&] {
+            for (const PurchaseEvent& event : stream) {
+                transaction.processPurchase(event.customer_id, event.product_id, event.quantity);
+            }
+        });
+    }
+
+    // Receipts
+    for (const auto& [formatName, format] : formats) {
+        suite.measure(formatName + "ReceiptFormat::generateReceipt", stream.size(), [&] {
+            for (std::size_t i = 0; i < stream.size(); ++i) {
+                checksum += format->generateReceipt(customerNames[i], productNames[i], stream[i].quantity, 9.99 * stream[i].quantity).size();
+            }
+        });
+        std::string buffer;
+        suite.measure(formatName + "ReceiptFormat::renderReceipt", stream.size(), [&] {
+            for (std::size_t i = 0; i < stream.size(); ++i) {
+                buffer.clear();
+                format->renderReceipt(buffer, customerNames[i], productNames[i], stream[i].quantity, 9.99 * stream[i].quantity);
+                checksum += buffer.size();
+            }
+        });
+    }
+
+    // Purchase histories and reports
+    PlainTextPurchaseHistoryFormatter historyFormatter;
+    suite.measure("PlainTextPurchaseHistoryFormatter::formatHistory", customerCount, [&] {
+        for (std::size_t id = 1; id <= customerCount; ++id) {
+            if (std::optional<PurchaseHistory::View> history = customerManager.findPurchaseHistory(static_cast<int>(id))) {
+                checksum += historyFormatter.formatHistory(*history).size();
+            }
+        }
+    });
+    const std::size_t reportRuns = 3;
+    InventoryReport inventoryReport(productManager);
+    suite.measure("InventoryReport::generate", reportRuns, [&] {
+        for (std::size_t i = 0; i < reportRuns; ++i) {
+            checksum += inventoryReport.generate().size();
+        }
+    });
+    SalesReport salesReport(customerManager, 10);
+    suite.measure("SalesReport::generate", reportRuns, [&] {
+        for (std::size_t i = 0; i < reportRuns; ++i) {
+            checksum += salesReport.generate().size();
+        }
+    });
+    benchmarkKeep(checksum);
+    benchmarkKeep(priceSum);
+    if (Instrumentation::enabled()) {
+        std::cout << "\n" << Instrumentation::dump();
+    }
+
+    const std::vector<std::pair<std::string, std::size_t>> parameters = {
+        {"products", productCount}, {"customers", customerCount}, {"categories", categoryCount}, {"operations", operations}};
+    if (jsonPath == "-") {
+        suite.writeJson(std::cout, parameters, zipfExponent);
+    } else {
+        std::ofstream json(jsonPath);
+        suite.writeJson(json, parameters, zipfExponent);
+        if (!json) {
+            std::cerr << "Could not write " << jsonPath << "\n";
+            return 1;
+        }
+        std::cout << "Results written to " << jsonPath << "\n";
+    }
+    return 0;
+}
@@ -0,0 +1,70 @@
+// CatalogBenchmark.cpp
+// Compares product lookup throughput of ProductManager's contiguous catalog against the
+// previous std::map<int, Product*> + std::map<int, Discount> layout.
+// Usage: CatalogBenchmark [productCount] [lookupCount]
+#include "Benchmark.h"
+#include "../ProductManager.h"
+#include <map>
+#include <random>
+#include <vector>
+
+int main(int argc, char** argv) {
+    const std::size_t productCount = benchmarkArgument(argc, argv, 1, 1000000);
+    const std::size_t lookupCount = benchmarkArgument(argc, argv, 2, 5000000);
+
+    Category category(1, "General");
+    ProductManager productManager;
+    productManager.reserve(productCount);
+    std::map<int, Product*> mapProducts;
+    std::map<int, Discount> mapDiscounts;
+
+    for (std::size_t i = 0; i < productCount; ++i) {
+        int id = static_cast<int>(i) + 1;
+        Product product(id, "Product " + std::to_string(id), 10.0 + (i % 1000), 100, &category);
+        mapProducts[id] = new Product(product);
+        productManager.addProduct(std::move(product));
+        if (i % 3 == 0) {
+            Discount discount(i % 2 ? "flat" : "percentage", 5.0);
+            mapDiscounts[id] = discount;
+            productManager.setDiscount(id, discount);
+        }
+    }
+
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> pick(1, static_cast<int>(productCount));
+    std::vector<int> ids(lookupCount);
+    for (int& id : ids) {
+        id = pick(rng);
+    }
+
+    std::cout << "Catalog of " << productCount << " products, " << lookupCount << " random lookups\n";
+
+    {
+        BenchmarkTimer timer;
+        double total = 0.0;
+        for (int id : ids) {
+            const Product* product = mapProducts.find(id)->second;
+            auto discount = mapDiscounts.find(id);
+            total += discount != mapDiscounts.end() ? discount->second.applyDiscount(product->getPrice())
+                                                    : product->getPrice();
+        }
+        benchmarkKeep(total);
+        benchmarkReport("std::map getProduct+getDiscountPrice", lookupCount, timer.elapsedSeconds());
+    }
+
+    {
+        BenchmarkTimer timer;
+        double total = 0.0;
+        for (int id : ids) {
+            const Product* product = productManager.getProduct(id);
+            total += productManager.getDiscountPrice(product->getProductId());
+        }
+        benchmarkKeep(total);
+        benchmarkReport("ProductCatalog getProduct+getDiscountPrice", lookupCount, timer.elapsedSeconds());
+    }
+
+    for (auto& pair : mapProducts) {
+        delete pair.second;
+    }
+    return 0;
+}
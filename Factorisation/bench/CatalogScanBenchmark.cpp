@@ -0,0 +1,92 @@
+// CatalogScanBenchmark.cpp
+// Cost of walking the catalog in ID order through ProductManager::getAllProducts, which
+// copies every product pointer into a new vector, versus the productsInIdOrder view, which
+// reads the catalog in place: a full scan, a lazily filtered scan, and a scan that stops
+// after the first matches. Each pair of scans is also checked for identical results.
+// Usage: CatalogScanBenchmark [productCount] [scans]
+#include "Benchmark.h"
+#include "Workload.h"
+#include <ranges>
+
+int main(int argc, char** argv) {
+    const std::size_t productCount = benchmarkArgument(argc, argv, 1, 2000000);
+    const std::size_t scans = benchmarkArgument(argc, argv, 2, 20);
+    const std::size_t firstMatches = 100;
+
+    std::mt19937_64 generator(5);
+    ProductManager productManager;
+    populateProducts(productManager, productCount, 100, 0, generator);
+    std::uniform_int_distribution<int> stock(0, 1000);
+    for (Product* product : productManager.productsInIdOrder()) {
+        product->updateQuantity(stock(generator));
+    }
+    auto lowStock = [](const Product* product) { return product->getQuantity() < 10; };
+    std::cout << productCount << " products, " << scans << " scans each\n";
+
+    long long copiedUnits = 0, viewedUnits = 0;
+    BenchmarkTimer copyTimer;
+    for (std::size_t scan = 0; scan < scans; ++scan) {
+        for (const Product* product : productManager.getAllProducts()) {
+            copiedUnits += product->getQuantity();
+        }
+    }
+    benchmarkReport("full scan, getAllProducts (copy)", scans * productCount, copyTimer.elapsedSeconds());
+    BenchmarkTimer viewTimer;
+    for (std::size_t scan = 0; scan < scans; ++scan) {
+        for (const Product* product : productManager.productsInIdOrder()) {
+            viewedUnits += product->getQuantity();
+        }
+    }
+    benchmarkReport("full scan, productsInIdOrder (view)", scans * productCount, viewTimer.elapsedSeconds());
+
+    std::vector<int> copiedLowStock, viewedLowStock;
+    BenchmarkTimer copyFilterTimer;
+    for (std::size_t scan = 0; scan < scans; ++scan) {
+        copiedLowStock.clear();
+        std::vector<Product*> products = productManager.getAllProducts();
+        for (const Product* product : products) {
+            if (lowStock(product)) {
+                copiedLowStock.push_back(product->getProductId());
+            }
+        }
+    }
+    benchmarkReport("low-stock filter, getAllProducts (copy)", scans * productCount, copyFilterTimer.elapsedSeconds());
+    BenchmarkTimer viewFilterTimer;
+    for (std::size_t scan = 0; scan < scans; ++scan) {
+        viewedLowStock.clear();
+        for (const Product* product : productManager.productsInIdOrder() | std::views::filter(lowStock)) {
+            viewedLowStock.push_back(product->getProductId());
+        }
+    }
+    benchmarkReport("low-stock filter, views::filter (view)", scans * productCount, viewFilterTimer.elapsedSeconds());
+
+    // Early stop: the first few low-stock products, as a paged "reorder" screen would show
+    std::vector<int> copiedFirst, viewedFirst;
+    BenchmarkTimer copyFirstTimer;
+    for (std::size_t scan = 0; scan < scans; ++scan) {
+        copiedFirst.clear();
+        for (const Product* product : productManager.getAllProducts()) {
+            if (lowStock(product)) {
+                copiedFirst.push_back(product->getProductId());
+                if (copiedFirst.size() == firstMatches) {
+                    break;
+                }
+            }
+        }
+    }
+    benchmarkReport("first 100 low-stock, getAllProducts (copy)", scans, copyFirstTimer.elapsedSeconds());
+    BenchmarkTimer viewFirstTimer;
+    for (std::size_t scan = 0; scan < scans; ++scan) {
+        viewedFirst.clear();
+        for (const Product* product : productManager.productsInIdOrder() | std::views::filter(lowStock) | std::views::take(firstMatches)) {
+            viewedFirst.push_back(product->getProductId());
+        }
+    }
+    benchmarkReport("first 100 low-stock, filter | take (view)", scans, viewFirstTimer.elapsedSeconds());
+
+    if (copiedUnits != viewedUnits || copiedLowStock != viewedLowStock || copiedFirst != viewedFirst) {
+        std::cerr << "View scans differ from the copied scans\n";
+        return 1;
+    }
+    return 0;
+}
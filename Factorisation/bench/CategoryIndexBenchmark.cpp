@@ -0,0 +1,91 @@
+// CategoryIndexBenchmark.cpp
+// Category page views on catalogs of growing size: a full scan filtering on getCategory()
+// (the previous getProductsByCategory), a page taken from the indexed getProductsByCategory
+// copy, and a page taken directly from the index. Indexed results are checked against the scan.
+// Usage: CategoryIndexBenchmark [largestCatalog] [categories] [pageSize]
+#include "Benchmark.h"
+#include "../ProductManager.h"
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+int main(int argc, char** argv) {
+    const std::size_t largestCatalog = benchmarkArgument(argc, argv, 1, 1000000);
+    const std::size_t categoryCount = benchmarkArgument(argc, argv, 2, 100);
+    const std::size_t pageSize = benchmarkArgument(argc, argv, 3, 50);
+
+    std::vector<std::unique_ptr<Category>> categories;
+    for (std::size_t c = 0; c < categoryCount; ++c) {
+        categories.push_back(std::make_unique<Category>(static_cast<int>(c), "Category"));
+    }
+
+    for (std::size_t productCount = 10000; productCount <= largestCatalog; productCount *= 10) {
+        ProductManager productManager;
+        productManager.reserve(productCount);
+        for (std::size_t i = 0; i < productCount; ++i) {
+            productManager.addProduct(Product(static_cast<int>(i) + 1, "Product", 4.0, 10,
+                                              categories[(i * 7) % categoryCount].get()));
+        }
+        // Scan baseline over the stored products, as the previous implementation did
+        const std::vector<Product*> allProducts = productManager.getAllProducts();
+        auto scan = [&](int category_id) {
+            std::vector<Product*> matches;
+            for (Product* product : allProducts) {
+                if (product->getCategory() && product->getCategory()->getCategoryId() == category_id) {
+                    matches.push_back(product);
+                }
+            }
+            return matches;
+        };
+        for (std::size_t c = 0; c < categoryCount; ++c) {
+            if (scan(static_cast<int>(c)) != productManager.getProductsByCategory(static_cast<int>(c))) {
+                std::cerr << "Index disagrees with scan for category " << c << "\n";
+                return 1;
+            }
+        }
+
+        std::cout << productCount << " products, " << categoryCount << " categories\n";
+        // Keep the slow scan to a bounded amount of work per catalog size
+        const std::size_t scanQueries = std::max<std::size_t>(1, 20000000 / productCount);
+        {
+            BenchmarkTimer timer;
+            std::size_t found = 0;
+            for (std::size_t q = 0; q < scanQueries; ++q) {
+                found += scan(static_cast<int>(q % categoryCount)).size();
+            }
+            benchmarkKeep(found);
+            benchmarkReport("  full scan (previous)", scanQueries, timer.elapsedSeconds());
+        }
+
+        const std::size_t queries = 200000;
+        {
+            BenchmarkTimer timer;
+            double total = 0.0;
+            for (std::size_t q = 0; q < queries / 10; ++q) {
+                std::vector<Product*> products = productManager.getProductsByCategory(static_cast<int>(q % categoryCount));
+                std::size_t pages = products.size() / pageSize + 1;
+                std::size_t begin = std::min(products.size(), (q % pages) * pageSize);
+                std::size_t end = std::min(products.size(), begin + pageSize);
+                for (std::size_t i = begin; i < end; ++i) {
+                    total += products[i]->getPrice();
+                }
+            }
+            benchmarkKeep(total);
+            benchmarkReport("  indexed, category copied then paged", queries / 10, timer.elapsedSeconds());
+        }
+        {
+            BenchmarkTimer timer;
+            double total = 0.0;
+            for (std::size_t q = 0; q < queries; ++q) {
+                int category_id = static_cast<int>(q % categoryCount);
+                std::size_t pages = productManager.countProductsByCategory(category_id) / pageSize + 1;
+                for (const Product* product : productManager.getProductsByCategory(category_id, (q % pages) * pageSize, pageSize)) {
+                    total += product->getPrice();
+                }
+            }
+            benchmarkKeep(total);
+            benchmarkReport("  indexed page view", queries, timer.elapsedSeconds());
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,98 @@
+// ConcurrentCheckoutBenchmark.cpp
+// Runs Transaction::tryPurchase from 1..N worker threads against a shared catalog.
+// Stock is deliberately scarce so threads race for the last units; after every run the
+// remaining stock is checked against the units sold, and any oversell fails the program.
+// Usage: ConcurrentCheckoutBenchmark [purchasesPerThread] [maxThreads]
+#include "Benchmark.h"
+#include "../ProductManager.h"
+#include "../CustomerManager.h"
+#include "../ReceiptFormat.h"
+#include "../Transaction.h"
+#include <algorithm>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr int kProducts = 1000;
+constexpr int kCustomers = 10000;
+
+// Returns false if any product sold more units than it had in stock
+bool runCheckout(unsigned threadCount, std::size_t purchasesPerThread) {
+    ProductManager productManager;
+    CustomerManager customerManager;
+    TextReceiptFormat receiptFormat;
+    Transaction transaction(productManager, customerManager, receiptFormat);
+
+    const int initialStock = static_cast<int>(purchasesPerThread * threadCount / kProducts);
+    for (int id = 1; id <= kProducts; ++id) {
+        productManager.addProduct(Product(id, "Product " + std::to_string(id), 9.99, initialStock));
+    }
+    for (int id = 1; id <= kCustomers; ++id) {
+        customerManager.addCustomer(new Customer(id, "Customer " + std::to_string(id), "customer@example.com"));
+    }
+
+    std::vector<std::vector<long long>> soldPerThread(threadCount, std::vector<long long>(kProducts + 1, 0));
+    std::vector<std::thread> workers;
+    BenchmarkTimer timer;
+    for (unsigned t = 0; t < threadCount; ++t) {
+        workers.emplace_back([&, t] {
+            std::mt19937 rng(t + 1);
+            std::uniform_int_distribution<int> product(1, kProducts);
+            std::uniform_int_distribution<int> customer(1, kCustomers);
+            std::uniform_int_distribution<int> quantity(1, 3);
+            for (std::size_t i = 0; i < purchasesPerThread; ++i) {
+                int productId = product(rng);
+                int units = quantity(rng);
+                if (transaction.tryPurchase(customer(rng), productId, units)) {
+                    soldPerThread[t][productId] += units;
+                }
+            }
+        });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    double seconds = timer.elapsedSeconds();
+
+    benchmarkReport("tryPurchase x" + std::to_string(threadCount) + " threads",
+                    purchasesPerThread * threadCount, seconds);
+
+    for (int id = 1; id <= kProducts; ++id) {
+        long long sold = 0;
+        for (const auto& sales : soldPerThread) {
+            sold += sales[id];
+        }
+        int remaining = productManager.getProduct(id)->getQuantity();
+        if (remaining < 0 || sold + remaining != initialStock) {
+            std::cerr << "Oversell detected for product " << id << ": sold " << sold
+                      << ", remaining " << remaining << ", initial " << initialStock << "\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t purchasesPerThread = benchmarkArgument(argc, argv, 1, 500000);
+    const unsigned maxThreads = static_cast<unsigned>(
+        benchmarkArgument(argc, argv, 2, std::max(1u, std::thread::hardware_concurrency())));
+
+    // Powers of two, always finishing with a run on every core
+    std::vector<unsigned> threadCounts;
+    for (unsigned threads = 1; threads < maxThreads; threads *= 2) {
+        threadCounts.push_back(threads);
+    }
+    threadCounts.push_back(maxThreads);
+
+    for (unsigned threads : threadCounts) {
+        if (!runCheckout(threads, purchasesPerThread)) {
+            return 1;
+        }
+    }
+    std::cout << "No oversell detected\n";
+    return 0;
+}
@@ -0,0 +1,131 @@
+// CsvImportBenchmark.cpp
+// Writes CSV files of categories, products, customers and discounts, then imports them with
+// CsvImporter on one thread and on a thread pool, next to a getline/stringstream product
+// parser as the baseline. Imported data is checked against what was written.
+// Usage: CsvImportBenchmark [products] [directory]
+#include "Benchmark.h"
+#include "../CsvImporter.h"
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct Files {
+    std::string categories, products, customers, discounts;
+};
+
+Files writeFiles(const std::string& directory, std::size_t productCount, std::size_t categoryCount, std::size_t customerCount) {
+    Files files{directory + "/bench_categories.csv", directory + "/bench_products.csv",
+                directory + "/bench_customers.csv", directory + "/bench_discounts.csv"};
+    std::ofstream categories(files.categories), products(files.products);
+    std::ofstream customers(files.customers), discounts(files.discounts);
+    categories << "category_id,name\n";
+    for (std::size_t c = 0; c < categoryCount; ++c) {
+        categories << c << ",Category " << c << "\n";
+    }
+    products << "product_id,name,price,quantity,category_id\n";
+    discounts << "product_id,rule,value\n";
+    for (std::size_t i = 1; i <= productCount; ++i) {
+        products << i << ",\"Product " << i << ", standard\"," << (i % 1000) << "." << (i % 100) << ","
+                 << (i % 500) << "," << (i % 10 == 0 ? std::string() : std::to_string(i % categoryCount)) << "\n";
+        if (i % 4 == 0) {
+            discounts << i << (i % 8 == 0 ? ",flat,5" : ",percentage,10,minimum_price,1") << "\n";
+        }
+    }
+    customers << "customer_id,name,email\n";
+    for (std::size_t i = 1; i <= customerCount; ++i) {
+        customers << i << ",Customer " << i << ",customer" << i << "@example.com\n";
+    }
+    return files;
+}
+
+// Baseline: line by line with a std::string per field
+std::size_t importProductsWithStreams(const std::string& path, ProductManager& productManager) {
+    std::ifstream in(path);
+    std::string line;
+    std::getline(in, line); // Header
+    std::size_t count = 0;
+    while (std::getline(in, line)) {
+        // Names contain a quoted comma; split them off first
+        std::size_t open = line.find('"'), close = line.find('"', open + 1);
+        std::string name = line.substr(open + 1, close - open - 1);
+        std::stringstream fields(line.substr(close + 2));
+        std::string price, quantity, category;
+        std::getline(fields, price, ',');
+        std::getline(fields, quantity, ',');
+        std::getline(fields, category, ',');
+        Category* productCategory = category.empty() ? nullptr : productManager.findCategory(std::stoi(category));
+        productManager.emplaceProduct(std::stoi(line.substr(0, open - 1)), name, std::stod(price), std::stoi(quantity), productCategory);
+        ++count;
+    }
+    return count;
+}
+
+void createCategories(ProductManager& productManager, std::size_t categoryCount) {
+    for (std::size_t c = 0; c < categoryCount; ++c) {
+        productManager.createCategory(static_cast<int>(c), "Category " + std::to_string(c));
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t productCount = benchmarkArgument(argc, argv, 1, 1000000);
+    const std::string directory = argc > 2 ? argv[2] : "/tmp";
+    const std::size_t categoryCount = 1000;
+    const std::size_t customerCount = productCount / 10;
+    Files files = writeFiles(directory, productCount, categoryCount, customerCount);
+    std::cout << productCount << " products, " << customerCount << " customers, " << productCount / 4 << " discounts\n";
+
+    {
+        ProductManager productManager;
+        createCategories(productManager, categoryCount);
+        productManager.reserve(productCount);
+        BenchmarkTimer timer;
+        std::size_t count = importProductsWithStreams(files.products, productManager);
+        benchmarkReport("products, getline + stringstream", count, timer.elapsedSeconds());
+    }
+
+    ThreadPool pool;
+    for (ThreadPool* threads : {static_cast<ThreadPool*>(nullptr), &pool}) {
+        std::string label = threads == nullptr ? "CsvImporter, 1 thread: " : "CsvImporter, " + std::to_string(pool.size()) + " threads: ";
+        ProductManager productManager;
+        CustomerManager customerManager;
+        CsvImporter importer(productManager, customerManager, threads);
+        {
+            BenchmarkTimer timer;
+            std::size_t count = importer.importCategories(files.categories);
+            count += importer.importProducts(files.products);
+            benchmarkReport(label + "categories + products", count, timer.elapsedSeconds());
+        }
+        {
+            BenchmarkTimer timer;
+            std::size_t count = importer.importCustomers(files.customers);
+            benchmarkReport(label + "customers", count, timer.elapsedSeconds());
+        }
+        {
+            BenchmarkTimer timer;
+            std::size_t count = importer.importDiscounts(files.discounts);
+            benchmarkReport(label + "discounts", count, timer.elapsedSeconds());
+        }
+
+        const Product* product = productManager.findProduct(static_cast<int>(productCount));
+        const Customer* customer = customerManager.findCustomer(static_cast<int>(customerCount));
+        if (product == nullptr || product->getName() != "Product " + std::to_string(productCount) + ", standard" ||
+            product->getQuantity() != static_cast<int>(productCount % 500) || customer == nullptr ||
+            customer->getEmail() != "customer" + std::to_string(customerCount) + "@example.com" ||
+            productManager.countProductsByCategory(1) == 0) {
+            std::cerr << "Imported data does not match the files\n";
+            return 1;
+        }
+    }
+
+    std::remove(files.categories.c_str());
+    std::remove(files.products.c_str());
+    std::remove(files.customers.c_str());
+    std::remove(files.discounts.c_str());
+    return 0;
+}
@@ -0,0 +1,85 @@
+// DiscountBenchmark.cpp
+// Price evaluations per second for the compiled Discount rules versus the previous
+// string-dispatched implementation, plus a stacked rule program. Every single-rule price
+// is checked against the previous implementation and must match exactly.
+// Usage: DiscountBenchmark [evaluations]
+#include "Benchmark.h"
+#include "../Discount.h"
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace {
+
+// Previous implementation, kept here as the baseline
+class LegacyDiscount {
+public:
+    LegacyDiscount(const std::string& discountType, double discountValue) : type(discountType), value(discountValue) {}
+
+    double applyDiscount(double originalPrice) const {
+        if (type == "flat") {
+            return std::max(0.0, originalPrice - value);
+        } else if (type == "percentage") {
+            return std::max(0.0, originalPrice * (1 - value / 100));
+        } else if (type == "none") {
+            return originalPrice;
+        } else {
+            throw std::invalid_argument("Invalid discount type");
+        }
+    }
+
+private:
+    std::string type;
+    double value;
+};
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t evaluations = benchmarkArgument(argc, argv, 1, 20000000);
+    constexpr std::size_t kDiscounts = 4096;
+
+    std::mt19937 rng(9);
+    std::uniform_real_distribution<double> price(0.0, 2000.0);
+    std::uniform_real_distribution<double> amount(0.0, 60.0);
+    const char* types[] = {"flat", "percentage", "none"};
+    std::vector<LegacyDiscount> legacy;
+    std::vector<Discount> compiled;
+    std::vector<Discount> stacked;
+    for (std::size_t i = 0; i < kDiscounts; ++i) {
+        const char* type = types[i % 3];
+        double value = amount(rng);
+        legacy.emplace_back(type, value);
+        compiled.emplace_back(type, value);
+        stacked.push_back(Discount(Discount::Rule::Flat, 5.0)
+                              .then(Discount::Rule::Percentage, value)
+                              .then(Discount::Rule::MaxSavings, 100.0)
+                              .then(Discount::Rule::MinimumPrice, 1.0));
+    }
+    std::vector<double> prices(kDiscounts);
+    for (double& p : prices) {
+        p = price(rng);
+    }
+
+    for (std::size_t i = 0; i < kDiscounts; ++i) {
+        if (legacy[i].applyDiscount(prices[i]) != compiled[i].applyDiscount(prices[i])) {
+            std::cerr << "Price mismatch for discount " << i << "\n";
+            return 1;
+        }
+    }
+
+    auto run = [&](const std::string& name, const auto& discounts) {
+        BenchmarkTimer timer;
+        double total = 0.0;
+        for (std::size_t i = 0; i < evaluations; ++i) {
+            std::size_t slot = i % kDiscounts;
+            total += discounts[slot].applyDiscount(prices[(slot * 7) % kDiscounts]);
+        }
+        benchmarkKeep(total);
+        benchmarkReport(name, evaluations, timer.elapsedSeconds());
+    };
+    run("string-dispatched Discount (previous)", legacy);
+    run("compiled Discount", compiled);
+    run("compiled 4-rule stack", stacked);
+    return 0;
+}
@@ -0,0 +1,125 @@
+// EntityLoadBenchmark.cpp
+// Bulk load and teardown of categories, products and customers: one new per entity (the
+// previous strategy, with a replica of the previous customer ownership) versus construction
+// in the managers' arena-backed storage. Each strategy runs in its own child process so the
+// resident set size it reports is not affected by the other.
+// Usage: EntityLoadBenchmark [entities] [categories]
+#include "Benchmark.h"
+#include "../ProductManager.h"
+#include "../CustomerManager.h"
+#include <fstream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace {
+
+// The previous CustomerManager ownership: one heap Customer per entry, deleted one by one
+class LegacyCustomerManager {
+public:
+    ~LegacyCustomerManager() {
+        for (auto& pair : customers) {
+            delete pair.second;
+        }
+    }
+
+    void addCustomer(Customer* customer) {
+        customers[customer->getCustomerId()] = customer;
+        customerPurchases.try_emplace(customer->getCustomerId(), productSales);
+    }
+
+private:
+    std::map<int, Customer*> customers;
+    std::map<int, PurchaseHistory> customerPurchases;
+    ProductSalesTable productSales;
+};
+
+// Resident set size of this process in MiB
+double residentMiB() {
+    std::ifstream statm("/proc/self/statm");
+    std::size_t pages = 0, resident = 0;
+    statm >> pages >> resident;
+    return static_cast<double>(resident) * static_cast<double>(sysconf(_SC_PAGESIZE)) / (1024.0 * 1024.0);
+}
+
+std::string customerName(std::size_t i) {
+    return "Customer number " + std::to_string(i); // Long enough to need a heap buffer
+}
+
+template <typename Customers, typename Load>
+void measure(const std::string& name, std::size_t entities, Load load) {
+    double before = residentMiB();
+    double loadSeconds = 0.0;
+    double teardownSeconds = 0.0;
+    double loadedMiB = 0.0;
+    {
+        auto productManager = std::make_unique<ProductManager>();
+        auto customerManager = std::make_unique<Customers>();
+        productManager->reserve(entities);
+        {
+            BenchmarkTimer timer;
+            load(*productManager, *customerManager);
+            loadSeconds = timer.elapsedSeconds();
+        }
+        loadedMiB = residentMiB() - before;
+        BenchmarkTimer timer;
+        productManager.reset();
+        customerManager.reset();
+        teardownSeconds = timer.elapsedSeconds();
+    }
+    benchmarkReport(name + " load", entities * 2, loadSeconds);
+    benchmarkReport(name + " teardown", entities * 2, teardownSeconds);
+    std::cout << "  resident after load: " << loadedMiB << " MiB\n";
+}
+
+template <typename Run>
+void inChildProcess(Run run) {
+    std::cout.flush();
+    pid_t child = fork();
+    if (child == 0) {
+        run();
+        std::cout.flush();
+        _exit(0);
+    }
+    int status = 0;
+    waitpid(child, &status, 0);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t entities = benchmarkArgument(argc, argv, 1, 1000000);
+    const std::size_t categoryCount = benchmarkArgument(argc, argv, 2, 1000);
+    std::cout << entities << " products, " << entities << " customers, " << categoryCount << " categories\n";
+
+    inChildProcess([&] {
+        measure<LegacyCustomerManager>("new per entity (previous)", entities, [&](ProductManager& products, LegacyCustomerManager& customers) {
+            std::vector<Category*> categories; // The previous code never freed categories
+            for (std::size_t c = 0; c < categoryCount; ++c) {
+                categories.push_back(new Category(static_cast<int>(c), "Category " + std::to_string(c)));
+            }
+            for (std::size_t i = 0; i < entities; ++i) {
+                int id = static_cast<int>(i) + 1;
+                products.addProduct(new Product(id, "Product", 4.0, 10, categories[i % categoryCount]));
+                customers.addCustomer(new Customer(id, customerName(i), "customer@example.com"));
+            }
+        });
+    });
+    inChildProcess([&] {
+        measure<CustomerManager>("arena-backed emplace", entities, [&](ProductManager& products, CustomerManager& customers) {
+            std::vector<Category*> categories;
+            for (std::size_t c = 0; c < categoryCount; ++c) {
+                categories.push_back(products.createCategory(static_cast<int>(c), "Category " + std::to_string(c)));
+            }
+            for (std::size_t i = 0; i < entities; ++i) {
+                int id = static_cast<int>(i) + 1;
+                products.emplaceProduct(id, "Product", 4.0, 10, categories[i % categoryCount]);
+                customers.emplaceCustomer(id, customerName(i), "customer@example.com");
+            }
+        });
+    });
+    return 0;
+}
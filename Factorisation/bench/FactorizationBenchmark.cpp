@@ -0,0 +1,111 @@
+// FactorizationBenchmark.cpp
+// Numbers factored per second by each FactoringMethod engine on uniform inputs and on
+// semiprimes (two primes of similar size, the worst case for trial division and rho).
+// Engines are skipped where they do not apply (the sieve above its limit) or would take
+// minutes (trial division on 64-bit inputs). Every engine's factors are checked against
+// Pollard's rho.
+// Usage: FactorizationBenchmark [numbersPerInputSet]
+#include "Benchmark.h"
+#include "../AdaptiveFactoring.h"
+#include "../FactorKernels.h"
+#include "../PollardRhoFactoring.h"
+#include "../SieveFactoring.h"
+#include "../TrialDivisionFactoring.h"
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+std::mt19937_64 rng(17);
+
+std::vector<std::uint64_t> uniform(std::size_t count, std::uint64_t low, std::uint64_t high) {
+    std::uniform_int_distribution<std::uint64_t> pick(low, high);
+    std::vector<std::uint64_t> numbers(count);
+    for (std::uint64_t& n : numbers) {
+        n = pick(rng);
+    }
+    return numbers;
+}
+
+std::uint64_t randomPrime(int bits) {
+    std::uniform_int_distribution<std::uint64_t> pick(1ull << (bits - 1), (1ull << bits) - 1);
+    std::uint64_t candidate;
+    do {
+        candidate = pick(rng);
+    } while (!isPrime(candidate));
+    return candidate;
+}
+
+std::vector<std::uint64_t> semiprimes(std::size_t count, int primeBits) {
+    std::vector<std::uint64_t> numbers(count);
+    for (std::uint64_t& n : numbers) {
+        n = randomPrime(primeBits) * randomPrime(primeBits);
+    }
+    return numbers;
+}
+
+struct InputSet {
+    std::string name;
+    std::vector<std::uint64_t> numbers;
+    std::uint64_t largest;
+};
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t count = benchmarkArgument(argc, argv, 1, 20000);
+
+    SieveFactoring sieve;
+    TrialDivisionFactoring trialDivision;
+    PollardRhoFactoring pollardRho;
+    AdaptiveFactoring adaptive;
+    struct Engine {
+        std::string name;
+        const FactoringMethod* method;
+        std::uint64_t largestInput;
+    };
+    const Engine engines[] = {
+        {"sieve", &sieve, sieve.getLimit()},
+        {"trial division", &trialDivision, 1ull << 40},
+        {"pollard rho", &pollardRho, UINT64_MAX},
+        {"adaptive", &adaptive, UINT64_MAX},
+    };
+
+    const InputSet inputs[] = {
+        {"uniform below 2^20", uniform(count, 2, 1u << 20), 1u << 20},
+        {"uniform below 2^32", uniform(count, 2, 0xFFFFFFFFu), 0xFFFFFFFFu},
+        {"uniform below 2^64", uniform(count, 2, UINT64_MAX), UINT64_MAX},
+        {"semiprimes of 16-bit primes", semiprimes(count, 16), 0xFFFFFFFFu},
+        {"semiprimes of 20-bit primes", semiprimes(count, 20), 1ull << 40},
+        {"semiprimes of 32-bit primes", semiprimes(count, 32), UINT64_MAX},
+    };
+
+    for (const InputSet& input : inputs) {
+        std::cout << input.name << "\n";
+        std::vector<std::vector<std::uint64_t>> expected;
+        expected.reserve(input.numbers.size());
+        for (std::uint64_t n : input.numbers) {
+            expected.push_back(pollardRho.factorize(n));
+        }
+        for (const Engine& engine : engines) {
+            if (input.largest > engine.largestInput) {
+                continue;
+            }
+            BenchmarkTimer timer;
+            std::size_t factors = 0;
+            for (std::uint64_t n : input.numbers) {
+                factors += engine.method->factorize(n).size();
+            }
+            benchmarkKeep(factors);
+            benchmarkReport("  " + engine.name, input.numbers.size(), timer.elapsedSeconds());
+            for (std::size_t i = 0; i < input.numbers.size(); ++i) {
+                if (engine.method->factorize(input.numbers[i]) != expected[i]) {
+                    std::cerr << engine.name << " disagrees on " << input.numbers[i] << "\n";
+                    return 1;
+                }
+            }
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,74 @@
+// FactorizationScalingBenchmark.cpp
+// Throughput of the batch factorization API from 1 to N threads on a mix of cheap inputs and
+// expensive semiprimes, next to one virtual factorize call per number. Batch results are
+// checked against the per-number calls.
+// Usage: FactorizationScalingBenchmark [numbers] [maxThreads]
+#include "Benchmark.h"
+#include "../AdaptiveFactoring.h"
+#include "../FactorKernels.h"
+#include "../FactorizationBatch.h"
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+int main(int argc, char** argv) {
+    const std::size_t count = benchmarkArgument(argc, argv, 1, 200000);
+    const unsigned maxThreads = static_cast<unsigned>(
+        benchmarkArgument(argc, argv, 2, std::max(1u, std::thread::hardware_concurrency())));
+
+    // Mostly uniform 64-bit numbers, with 1 in 64 a semiprime of two 24-bit primes, clustered
+    // so that a static split would hand some threads far more work than others
+    std::mt19937_64 rng(23);
+    std::uniform_int_distribution<std::uint64_t> prime24(1u << 23, (1u << 24) - 1);
+    auto randomPrime = [&] {
+        std::uint64_t candidate;
+        do {
+            candidate = prime24(rng);
+        } while (!isPrime(candidate));
+        return candidate;
+    };
+    std::vector<std::uint64_t> numbers(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        numbers[i] = i < count / 16 && i % 4 == 0 ? randomPrime() * randomPrime() : rng();
+    }
+
+    AdaptiveFactoring engine;
+    const FactoringMethod& method = engine;
+    std::vector<std::vector<std::uint64_t>> expected(count);
+    {
+        BenchmarkTimer timer;
+        for (std::size_t i = 0; i < count; ++i) {
+            expected[i] = method.factorize(numbers[i]);
+        }
+        benchmarkReport("factorize per number (virtual, allocating)", count, timer.elapsedSeconds());
+    }
+
+    std::vector<unsigned> threadCounts;
+    for (unsigned threads = 1; threads < maxThreads; threads *= 2) {
+        threadCounts.push_back(threads);
+    }
+    threadCounts.push_back(maxThreads);
+
+    FactorizationBatch batch;
+    {
+        BenchmarkTimer timer;
+        method.factorizeBatch(numbers, batch);
+        benchmarkReport("factorizeBatch, calling thread only", count, timer.elapsedSeconds());
+    }
+    for (unsigned threads : threadCounts) {
+        ThreadPool pool(threads);
+        BenchmarkTimer timer;
+        method.factorizeBatch(numbers, batch, &pool);
+        benchmarkReport("factorizeBatch, " + std::to_string(threads) + " threads", count, timer.elapsedSeconds());
+
+        for (std::size_t i = 0; i < count; ++i) {
+            std::span<const std::uint64_t> factors = batch.factorsOf(i);
+            if (!std::equal(factors.begin(), factors.end(), expected[i].begin(), expected[i].end())) {
+                std::cerr << "Batch factors differ for " << numbers[i] << "\n";
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
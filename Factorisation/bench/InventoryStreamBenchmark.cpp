@@ -0,0 +1,94 @@
+// InventoryStreamBenchmark.cpp
+// Rows per second for the previous inventory display (a copied product vector written to
+// the stream field by field) versus InventoryUI::streamInventory, both writing to /dev/null,
+// plus paged output. The streamed text is checked against the previous output, and every
+// page against the matching slice of the full listing.
+// Usage: InventoryStreamBenchmark [productCount] [pageSize]
+#include "Benchmark.h"
+#include "Workload.h"
+#include "../InventoryUI.h"
+#include <fstream>
+#include <sstream>
+
+namespace {
+
+// Previous InventoryUI::displayInventory, writing to any stream
+void legacyDisplayInventory(std::ostream& out, const std::vector<Product*>& products) {
+    if (products.empty()) {
+        out << "Inventory is empty.\n";
+        return;
+    }
+    for (const auto& product : products) {
+        out << "Product ID: " << product->getProductId()
+            << ", Name: " << product->getName()
+            << ", Category: ";
+        if (product->getCategory() && !product->getCategory()->getName().empty()) {
+            out << product->getCategory()->getName();
+        } else {
+            out << "None";
+        }
+        out << ", Price: $" << std::fixed << std::setprecision(2) << product->getPrice()
+            << ", Quantity: " << product->getQuantity() << "\n";
+    }
+    out << "--------------------------\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t productCount = benchmarkArgument(argc, argv, 1, 2000000);
+    const std::size_t pageSize = benchmarkArgument(argc, argv, 2, 50);
+
+    std::mt19937_64 generator(9);
+    ProductManager productManager;
+    populateProducts(productManager, productCount, 100, 250, generator);
+    std::cout << productCount << " products\n";
+
+    std::ofstream devNull("/dev/null");
+    BenchmarkTimer legacyTimer;
+    legacyDisplayInventory(devNull, productManager.getAllProducts());
+    benchmarkReport("field-by-field ostream (previous)", productCount, legacyTimer.elapsedSeconds());
+
+    BenchmarkTimer streamTimer;
+    std::size_t rows = InventoryUI::streamInventory(productManager, devNull);
+    benchmarkReport("InventoryUI::streamInventory", rows, streamTimer.elapsedSeconds());
+
+    const std::size_t pages = std::min<std::size_t>(100000, productCount / std::max<std::size_t>(1, pageSize));
+    std::size_t pagedRows = 0;
+    BenchmarkTimer pageTimer;
+    for (std::size_t page = 0; page < pages; ++page) {
+        pagedRows += InventoryUI::streamInventory(productManager, devNull, page * pageSize, pageSize, 1 << 16);
+    }
+    benchmarkReport("streamInventory, pages of " + std::to_string(pageSize), pages, pageTimer.elapsedSeconds());
+    benchmarkKeep(pagedRows);
+
+    // Compare the text on a prefix of the catalog small enough to hold in memory twice
+    const std::size_t checked = std::min<std::size_t>(productCount, 200000);
+    std::vector<Product*> prefix = productManager.getAllProducts();
+    prefix.resize(checked);
+    std::ostringstream expected, streamed;
+    legacyDisplayInventory(expected, prefix);
+    InventoryUI::streamInventory(productManager, streamed, 0, checked);
+    if (streamed.str() != expected.str()) {
+        std::cerr << "streamInventory output differs from the previous display\n";
+        return 1;
+    }
+    const std::string full = expected.str();
+    const std::string closing = "--------------------------\n";
+    std::size_t rowStart = 0;
+    for (std::size_t offset = 0; offset < checked; offset += pageSize) {
+        std::size_t count = std::min(pageSize, checked - offset);
+        std::size_t rowEnd = rowStart;
+        for (std::size_t i = 0; i < count; ++i) {
+            rowEnd = full.find('\n', rowEnd) + 1;
+        }
+        std::ostringstream page;
+        InventoryUI::streamInventory(productManager, page, offset, count, 4096);
+        if (page.str() != full.substr(rowStart, rowEnd - rowStart) + closing) {
+            std::cerr << "Page at offset " << offset << " differs from the full listing\n";
+            return 1;
+        }
+        rowStart = rowEnd;
+    }
+    return 0;
+}
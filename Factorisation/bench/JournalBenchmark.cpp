@@ -0,0 +1,58 @@
+// JournalBenchmark.cpp
+// Write throughput of TransactionJournal group commits and the time to replay the journal
+// into freshly initialised managers.
+// Usage: JournalBenchmark [records] [journalFile] [groupCommitRecords]
+#include "Benchmark.h"
+#include "../TransactionJournal.h"
+#include <cstdio>
+
+namespace {
+
+constexpr int kProducts = 10000;
+constexpr int kCustomers = 100000;
+
+void populate(ProductManager& productManager, CustomerManager& customerManager, std::size_t records) {
+    const int stock = static_cast<int>(records / kProducts + 1);
+    productManager.reserve(kProducts);
+    for (int id = 1; id <= kProducts; ++id) {
+        productManager.addProduct(Product(id, "Product " + std::to_string(id), 12.5, stock));
+    }
+    for (int id = 1; id <= kCustomers; ++id) {
+        customerManager.addCustomer(new Customer(id, "Customer " + std::to_string(id), "customer@example.com"));
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t records = benchmarkArgument(argc, argv, 1, 10000000);
+    const std::string path = argc > 2 ? argv[2] : "journal.bench.bin";
+    const std::size_t groupCommit = benchmarkArgument(argc, argv, 3, 4096);
+    std::remove(path.c_str());
+
+    {
+        TransactionJournal journal(path, groupCommit);
+        BenchmarkTimer timer;
+        for (std::size_t i = 0; i < records; ++i) {
+            journal.append(static_cast<int>(i % kCustomers) + 1, static_cast<int>(i % kProducts) + 1, 1, 12.5);
+        }
+        journal.commit();
+        benchmarkReport("journal append (group commit " + std::to_string(groupCommit) + ")", records, timer.elapsedSeconds());
+    }
+
+    {
+        ProductManager productManager;
+        CustomerManager customerManager;
+        populate(productManager, customerManager, records);
+
+        BenchmarkTimer timer;
+        TransactionJournal journal(path, groupCommit);
+        std::size_t replayed = journal.replay(productManager, customerManager);
+        double seconds = timer.elapsedSeconds();
+        benchmarkReport("journal open + replay", replayed, seconds);
+        std::cout << "Replayed " << replayed << " records in " << std::setprecision(3) << seconds << " s\n";
+    }
+
+    std::remove(path.c_str());
+    return 0;
+}
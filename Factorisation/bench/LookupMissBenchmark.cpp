@@ -0,0 +1,68 @@
+// LookupMissBenchmark.cpp
+// Miss-heavy probing of ProductManager and CustomerManager: the throwing getters caught
+// with try/catch versus the find* API that reports a miss through its return value.
+// Usage: LookupMissBenchmark [probes] [hitPercent]
+#include "Benchmark.h"
+#include "../ProductManager.h"
+#include "../CustomerManager.h"
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+int main(int argc, char** argv) {
+    const std::size_t probes = benchmarkArgument(argc, argv, 1, 2000000);
+    const std::size_t hitPercent = benchmarkArgument(argc, argv, 2, 10);
+    constexpr int kEntities = 100000;
+
+    ProductManager productManager;
+    CustomerManager customerManager;
+    for (int id = 1; id <= kEntities; ++id) {
+        productManager.addProduct(Product(id, "Product", 4.0, 10));
+        customerManager.addCustomer(new Customer(id, "Customer", "customer@example.com"));
+        if (id % 2 == 0) {
+            customerManager.addPurchase(id, "Product", 1, 4.0);
+        }
+    }
+
+    // IDs above kEntities miss; the rest hit
+    std::mt19937 rng(5);
+    std::uniform_int_distribution<int> present(1, kEntities);
+    std::uniform_int_distribution<int> absent(kEntities + 1, 4 * kEntities);
+    std::uniform_int_distribution<std::size_t> percent(0, 99);
+    std::vector<int> ids(probes);
+    for (int& id : ids) {
+        id = percent(rng) < hitPercent ? present(rng) : absent(rng);
+    }
+    std::cout << probes << " probes, " << hitPercent << "% hits\n";
+
+    {
+        BenchmarkTimer timer;
+        std::size_t found = 0;
+        for (int id : ids) {
+            try {
+                found += productManager.getProduct(id) != nullptr;
+                found += customerManager.getCustomer(id) != nullptr;
+                found += customerManager.getPurchaseHistory(id).size();
+            } catch (const std::invalid_argument&) {
+            }
+        }
+        benchmarkKeep(found);
+        benchmarkReport("get* with try/catch", probes, timer.elapsedSeconds());
+    }
+    {
+        BenchmarkTimer timer;
+        std::size_t found = 0;
+        for (int id : ids) {
+            if (productManager.findProduct(id) == nullptr || customerManager.findCustomer(id) == nullptr) {
+                continue;
+            }
+            found += 2;
+            if (auto history = customerManager.findPurchaseHistory(id)) {
+                found += history->size();
+            }
+        }
+        benchmarkKeep(found);
+        benchmarkReport("find* (no exceptions)", probes, timer.elapsedSeconds());
+    }
+    return 0;
+}
@@ -0,0 +1,113 @@
+// PurchaseCycleBenchmark.cpp
+// Throughput and heap allocations of a full store cycle: checkout through
+// Transaction::processPurchase, then the inventory report, the streamed inventory listing,
+// the sales report and every customer's purchase history. Entity names and emails are of
+// realistic length (longer than the small-string buffer), so copying one costs an allocation.
+// Allocations are counted by replacing the global operator new.
+// Usage: PurchaseCycleBenchmark [products] [customers] [purchases]
+#include "Benchmark.h"
+#include "Workload.h"
+#include "../InventoryReport.h"
+#include "../InventoryUI.h"
+#include "../PlainTextPurchaseHistoryFormatter.h"
+#include "../ReceiptFormat.h"
+#include "../ReceiptSink.h"
+#include "../SalesReport.h"
+#include "../Transaction.h"
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <new>
+
+namespace {
+
+std::atomic<std::size_t> allocationCount{0};
+
+// Run body once, reporting time per operation and allocations per operation
+void measure(const std::string& name, std::size_t operations, const std::function<void()>& body) {
+    std::size_t allocationsBefore = allocationCount.load(std::memory_order_relaxed);
+    BenchmarkTimer timer;
+    body();
+    double seconds = timer.elapsedSeconds();
+    std::size_t allocations = allocationCount.load(std::memory_order_relaxed) - allocationsBefore;
+    benchmarkReport(name, operations, seconds);
+    std::cout << "    " << std::setprecision(2) << static_cast<double>(allocations) / operations << " allocations/op\n";
+}
+
+} // namespace
+
+void* operator new(std::size_t size) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (void* memory = std::malloc(size == 0 ? 1 : size)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+int main(int argc, char** argv) {
+    const std::size_t productCount = benchmarkArgument(argc, argv, 1, 200000);
+    const std::size_t customerCount = benchmarkArgument(argc, argv, 2, 50000);
+    const std::size_t purchases = benchmarkArgument(argc, argv, 3, 1000000);
+    const std::size_t categoryCount = 50;
+
+    ProductManager productManager;
+    CustomerManager customerManager;
+    std::vector<Category*> categories;
+    for (std::size_t id = 1; id <= categoryCount; ++id) {
+        categories.push_back(productManager.createCategory(static_cast<int>(id), "Home, Kitchen and Dining " + std::to_string(id)));
+    }
+    productManager.reserve(productCount);
+    for (std::size_t id = 1; id <= productCount; ++id) {
+        productManager.emplaceProduct(static_cast<int>(id), "Stainless Steel Water Bottle #" + std::to_string(id),
+                                      12.5 + static_cast<double>(id % 200), 1000000000, categories[id % categoryCount]);
+    }
+    for (std::size_t id = 1; id <= customerCount; ++id) {
+        customerManager.emplaceCustomer(static_cast<int>(id), "Alexandra Montgomery-Smith " + std::to_string(id),
+                                        "alexandra.montgomery." + std::to_string(id) + "@example.com");
+    }
+    std::mt19937_64 generator(17);
+    std::vector<PurchaseEvent> stream = zipfPurchaseStream(purchases, customerCount, productCount, 1.0, generator);
+    std::cout << productCount << " products, " << customerCount << " customers, " << purchases << " purchases\n";
+
+    TextReceiptFormat receiptFormat;
+    NullReceiptSink sink;
+    Transaction transaction(productManager, customerManager, receiptFormat, sink);
+    measure("Transaction::processPurchase", stream.size(), [&] {
+        for (const PurchaseEvent& event : stream) {
+            transaction.processPurchase(event.customer_id, event.product_id, event.quantity);
+        }
+    });
+
+    std::size_t checksum = 0;
+    InventoryReport inventoryReport(productManager);
+    measure("InventoryReport::generate (per product)", productCount, [&] {
+        checksum += inventoryReport.generate().size();
+    });
+    std::ofstream devNull("/dev/null");
+    measure("InventoryUI::streamInventory (per product)", productCount, [&] {
+        checksum += InventoryUI::streamInventory(productManager, devNull);
+    });
+    SalesReport salesReport(customerManager, 10);
+    measure("SalesReport::generate (per customer)", customerCount, [&] {
+        checksum += salesReport.generate().size();
+    });
+    PlainTextPurchaseHistoryFormatter historyFormatter;
+    measure("formatHistory (per customer)", customerCount, [&] {
+        for (std::size_t id = 1; id <= customerCount; ++id) {
+            if (std::optional<PurchaseHistory::View> history = customerManager.findPurchaseHistory(static_cast<int>(id))) {
+                checksum += historyFormatter.formatHistory(*history).size();
+            }
+        }
+    });
+    benchmarkKeep(checksum);
+    return 0;
+}
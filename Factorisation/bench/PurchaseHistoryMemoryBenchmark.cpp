@@ -0,0 +1,98 @@
+// PurchaseHistoryMemoryBenchmark.cpp
+// Heap footprint and insert time of the columnar PurchaseHistory, which records product IDs
+// and keeps each name once in a ProductSalesTable, compared with the previous std::vector of
+// records that each held a copy of the product name.
+// Usage: PurchaseHistoryMemoryBenchmark [purchases]
+#include "Benchmark.h"
+#include "../CustomerManager.h"
+#include <atomic>
+#include <cstdlib>
+#include <map>
+#include <new>
+#include <vector>
+
+namespace {
+
+std::atomic<long long> liveBytes{0};
+
+// Every allocation carries its size in front so frees can be accounted for
+constexpr std::size_t kPrefix = alignof(std::max_align_t);
+
+void* countedAllocate(std::size_t size) {
+    void* block = std::malloc(size + kPrefix);
+    if (block == nullptr) {
+        throw std::bad_alloc();
+    }
+    *static_cast<std::size_t*>(block) = size;
+    liveBytes += static_cast<long long>(size);
+    return static_cast<char*>(block) + kPrefix;
+}
+
+void countedFree(void* pointer) noexcept {
+    if (pointer == nullptr) {
+        return;
+    }
+    void* block = static_cast<char*>(pointer) - kPrefix;
+    liveBytes -= static_cast<long long>(*static_cast<std::size_t*>(block));
+    std::free(block);
+}
+
+constexpr int kProducts = 10000;
+constexpr int kCustomers = 100000;
+
+// Previous record layout
+struct LegacyPurchase {
+    std::string product_name;
+    int quantity;
+    double total_cost;
+};
+
+} // namespace
+
+void* operator new(std::size_t size) { return countedAllocate(size); }
+void* operator new[](std::size_t size) { return countedAllocate(size); }
+void operator delete(void* pointer) noexcept { countedFree(pointer); }
+void operator delete[](void* pointer) noexcept { countedFree(pointer); }
+void operator delete(void* pointer, std::size_t) noexcept { countedFree(pointer); }
+void operator delete[](void* pointer, std::size_t) noexcept { countedFree(pointer); }
+
+int main(int argc, char** argv) {
+    const std::size_t purchases = benchmarkArgument(argc, argv, 1, 5000000);
+
+    std::vector<std::string> names;
+    for (int id = 0; id < kProducts; ++id) {
+        names.push_back("Wireless Optical Mouse, Model " + std::to_string(100000 + id));
+    }
+
+    {
+        long long before = liveBytes;
+        BenchmarkTimer timer;
+        std::map<int, std::vector<LegacyPurchase>> histories;
+        for (std::size_t i = 0; i < purchases; ++i) {
+            histories[static_cast<int>(i % kCustomers)].push_back({names[i % kProducts], 1, 9.99});
+        }
+        double seconds = timer.elapsedSeconds();
+        long long bytes = liveBytes - before;
+        benchmarkReport("vector<Purchase> with name copies", purchases, seconds);
+        std::cout << "  heap bytes: " << bytes << " (" << std::setprecision(1)
+                  << static_cast<double>(bytes) / purchases << " per purchase)\n";
+    }
+
+    {
+        CustomerManager customerManager;
+        for (int id = 0; id < kCustomers; ++id) {
+            customerManager.addCustomer(new Customer(id, "Customer", "customer@example.com"));
+        }
+        long long before = liveBytes;
+        BenchmarkTimer timer;
+        for (std::size_t i = 0; i < purchases; ++i) {
+            customerManager.addPurchase(static_cast<int>(i % kCustomers), static_cast<int>(i % kProducts), names[i % kProducts], 1, 9.99);
+        }
+        double seconds = timer.elapsedSeconds();
+        long long bytes = liveBytes - before;
+        benchmarkReport("columnar PurchaseHistory + ProductSalesTable", purchases, seconds);
+        std::cout << "  heap bytes: " << bytes << " (" << std::setprecision(1)
+                  << static_cast<double>(bytes) / purchases << " per purchase)\n";
+    }
+    return 0;
+}
@@ -0,0 +1,98 @@
+// ReceiptRenderBenchmark.cpp
+// Receipts per second for the previous std::ostringstream rendering versus
+// ReceiptFormat::renderReceipt into a reused buffer, for both built-in formats.
+// Every rendered receipt is also compared against the ostringstream text.
+// Usage: ReceiptRenderBenchmark [receipts]
+#include "Benchmark.h"
+#include "../ReceiptFormat.h"
+#include <iomanip>
+#include <random>
+#include <sstream>
+#include <vector>
+
+namespace {
+
+// Previous implementations, kept here as the baseline
+std::string legacyTextReceipt(const std::string& customerName, const std::string& productName, int quantity, double totalCost) {
+    std::ostringstream receipt;
+    receipt << "\n--- Receipt ---\n";
+    receipt << "Customer: " << customerName << "\n";
+    receipt << "Product: " << productName << "\n";
+    receipt << "Quantity: " << quantity << "\n";
+    receipt << "Total Cost: $" << std::fixed << std::setprecision(2) << totalCost << "\n";
+    receipt << "-----------------\n\n";
+    return receipt.str();
+}
+
+std::string legacyHtmlReceipt(const std::string& customerName, const std::string& productName, int quantity, double totalCost) {
+    std::ostringstream receipt;
+    receipt << "<html>\n<head><title>Receipt</title></head>\n<body>\n";
+    receipt << "<h1>Receipt</h1>\n";
+    receipt << "<p><strong>Customer:</strong> " << customerName << "</p>\n";
+    receipt << "<p><strong>Product:</strong> " << productName << "</p>\n";
+    receipt << "<p><strong>Quantity:</strong> " << quantity << "</p>\n";
+    receipt << "<p><strong>Total Cost:</strong> $" << std::fixed << std::setprecision(2) << totalCost << "</p>\n";
+    receipt << "</body>\n</html>\n";
+    return receipt.str();
+}
+
+struct Sale {
+    std::string customer;
+    std::string product;
+    int quantity;
+    double totalCost;
+};
+
+using LegacyRenderer = std::string (*)(const std::string&, const std::string&, int, double);
+
+bool compare(const std::string& name, const ReceiptFormat& format, LegacyRenderer legacy, const std::vector<Sale>& sales) {
+    std::size_t checksum = 0;
+    BenchmarkTimer legacyTimer;
+    for (const Sale& sale : sales) {
+        checksum += legacy(sale.customer, sale.product, sale.quantity, sale.totalCost).size();
+    }
+    benchmarkReport(name + " ostringstream", sales.size(), legacyTimer.elapsedSeconds());
+
+    std::string buffer;
+    BenchmarkTimer renderTimer;
+    for (const Sale& sale : sales) {
+        buffer.clear();
+        format.renderReceipt(buffer, sale.customer, sale.product, sale.quantity, sale.totalCost);
+        checksum += buffer.size();
+    }
+    benchmarkReport(name + " renderReceipt", sales.size(), renderTimer.elapsedSeconds());
+    benchmarkKeep(checksum);
+
+    for (const Sale& sale : sales) {
+        buffer.clear();
+        format.renderReceipt(buffer, sale.customer, sale.product, sale.quantity, sale.totalCost);
+        if (buffer != legacy(sale.customer, sale.product, sale.quantity, sale.totalCost)) {
+            std::cerr << name << " output differs for total " << sale.totalCost << "\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t receipts = benchmarkArgument(argc, argv, 1, 1000000);
+
+    std::mt19937 rng(3);
+    std::uniform_int_distribution<int> quantity(1, 20);
+    std::uniform_real_distribution<double> price(0.01, 5000.0);
+    std::vector<Sale> sales;
+    sales.reserve(receipts);
+    for (std::size_t i = 0; i < receipts; ++i) {
+        int units = quantity(rng);
+        sales.push_back({"Customer " + std::to_string(i % 5000), "Product " + std::to_string(i % 20000),
+                         units, price(rng) * units});
+    }
+
+    TextReceiptFormat text;
+    HTMLReceiptFormat html;
+    bool identical = compare("Text", text, legacyTextReceipt, sales) &&
+                     compare("HTML", html, legacyHtmlReceipt, sales);
+    return identical ? 0 : 1;
+}
@@ -0,0 +1,68 @@
+// ReceiptSinkBenchmark.cpp
+// Measures Transaction::processPurchase throughput with different receipt sinks:
+// discarding output, writing to a file synchronously, and writing to the same file
+// through AsyncReceiptSink's background writer.
+// Usage: ReceiptSinkBenchmark [purchases] [receiptFile]
+#include "Benchmark.h"
+#include "../ProductManager.h"
+#include "../CustomerManager.h"
+#include "../ReceiptFormat.h"
+#include "../ReceiptSink.h"
+#include "../AsyncReceiptSink.h"
+#include "../Transaction.h"
+#include <cstdio>
+
+namespace {
+
+constexpr int kProducts = 1000;
+constexpr int kCustomers = 1000;
+
+void runPurchases(const std::string& name, ReceiptSink& sink, std::size_t purchases) {
+    ProductManager productManager;
+    CustomerManager customerManager;
+    TextReceiptFormat receiptFormat;
+    for (int id = 1; id <= kProducts; ++id) {
+        productManager.addProduct(Product(id, "Product " + std::to_string(id), 24.5, 1 << 30));
+        productManager.setDiscount(id, Discount("percentage", 10.0));
+    }
+    for (int id = 1; id <= kCustomers; ++id) {
+        customerManager.addCustomer(new Customer(id, "Customer " + std::to_string(id), "customer@example.com"));
+    }
+    Transaction transaction(productManager, customerManager, receiptFormat, sink);
+
+    BenchmarkTimer timer;
+    for (std::size_t i = 0; i < purchases; ++i) {
+        transaction.processPurchase(static_cast<int>(i % kCustomers) + 1, static_cast<int>(i % kProducts) + 1, 1);
+    }
+    double checkoutSeconds = timer.elapsedSeconds();
+    transaction.flushReceipts();
+    double totalSeconds = timer.elapsedSeconds();
+
+    benchmarkReport(name + " (checkout)", purchases, checkoutSeconds);
+    benchmarkReport(name + " (including flush)", purchases, totalSeconds);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t purchases = benchmarkArgument(argc, argv, 1, 200000);
+    const std::string path = argc > 2 ? argv[2] : "receipts.bench.txt";
+
+    {
+        NullReceiptSink sink;
+        runPurchases("NullReceiptSink", sink, purchases);
+    }
+    std::remove(path.c_str());
+    {
+        FileReceiptSink sink(path);
+        runPurchases("FileReceiptSink", sink, purchases);
+    }
+    std::remove(path.c_str());
+    {
+        FileReceiptSink file(path);
+        AsyncReceiptSink sink(file);
+        runPurchases("AsyncReceiptSink over file", sink, purchases);
+    }
+    std::remove(path.c_str());
+    return 0;
+}
@@ -0,0 +1,76 @@
+// ReportScalingBenchmark.cpp
+// InventoryReport and SalesReport generation time with 1..N worker threads.
+// Each parallel report is compared with the sequential text and must match exactly.
+// Usage: ReportScalingBenchmark [products] [customers] [maxThreads]
+#include "Benchmark.h"
+#include "../InventoryReport.h"
+#include "../SalesReport.h"
+#include "../ThreadPool.h"
+#include <thread>
+#include <vector>
+
+namespace {
+
+bool measure(const std::string& name, const Report& sequential, const std::vector<const Report*>& parallel,
+             const std::vector<unsigned>& threadCounts) {
+    BenchmarkTimer timer;
+    std::string expected = sequential.generate();
+    benchmarkReport(name + " sequential", 1, timer.elapsedSeconds());
+
+    for (std::size_t i = 0; i < parallel.size(); ++i) {
+        BenchmarkTimer parallelTimer;
+        std::string text = parallel[i]->generate();
+        benchmarkReport(name + " x" + std::to_string(threadCounts[i]) + " threads", 1, parallelTimer.elapsedSeconds());
+        if (text != expected) {
+            std::cerr << name << " output with " << threadCounts[i] << " threads differs from sequential\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t products = benchmarkArgument(argc, argv, 1, 2000000);
+    const std::size_t customers = benchmarkArgument(argc, argv, 2, 1000000);
+    const unsigned maxThreads = static_cast<unsigned>(
+        benchmarkArgument(argc, argv, 3, std::max(1u, std::thread::hardware_concurrency())));
+
+    ProductManager productManager;
+    productManager.reserve(products);
+    for (std::size_t id = 1; id <= products; ++id) {
+        productManager.addProduct(Product(static_cast<int>(id), "Product " + std::to_string(id), 0.5 * (id % 4000), 25));
+    }
+    CustomerManager customerManager;
+    for (std::size_t id = 1; id <= customers; ++id) {
+        customerManager.addCustomer(new Customer(static_cast<int>(id), "Customer " + std::to_string(id), "customer@example.com"));
+        if (id % 3 == 0) {
+            customerManager.addPurchase(static_cast<int>(id), "Product " + std::to_string(id % 1000), 2, 3.5 * (id % 7));
+        }
+    }
+
+    std::vector<unsigned> threadCounts;
+    for (unsigned threads = 1; threads < maxThreads; threads *= 2) {
+        threadCounts.push_back(threads);
+    }
+    threadCounts.push_back(maxThreads);
+
+    std::vector<std::unique_ptr<ThreadPool>> pools;
+    std::vector<std::unique_ptr<Report>> reports;
+    std::vector<const Report*> inventoryReports;
+    std::vector<const Report*> salesReports;
+    for (unsigned threads : threadCounts) {
+        pools.push_back(std::make_unique<ThreadPool>(threads));
+        reports.push_back(std::make_unique<InventoryReport>(productManager, pools.back().get()));
+        inventoryReports.push_back(reports.back().get());
+        reports.push_back(std::make_unique<SalesReport>(customerManager, 5, pools.back().get()));
+        salesReports.push_back(reports.back().get());
+    }
+
+    InventoryReport inventoryReport(productManager);
+    SalesReport salesReport(customerManager);
+    bool identical = measure("InventoryReport", inventoryReport, inventoryReports, threadCounts) &&
+                     measure("SalesReport", salesReport, salesReports, threadCounts);
+    return identical ? 0 : 1;
+}
@@ -0,0 +1,114 @@
+// RepricingBenchmark.cpp
+// Discounted prices for a whole catalog: one getDiscountPrice call per product ID versus the
+// bulk repriceAll pass, per-ID lookups in the resulting PriceTable, and the raw scalar versus
+// dispatched (AVX2 where available) kernels.
+// Every bulk price is checked against getDiscountPrice and must match exactly.
+// Usage: RepricingBenchmark [products] [rounds]
+#include "Benchmark.h"
+#include "../ProductManager.h"
+#include "../Repricing.h"
+#include <limits>
+#include <random>
+#include <vector>
+
+int main(int argc, char** argv) {
+    const std::size_t productCount = benchmarkArgument(argc, argv, 1, 1000000);
+    const std::size_t rounds = benchmarkArgument(argc, argv, 2, 10);
+
+    std::mt19937 rng(12);
+    std::uniform_real_distribution<double> price(0.0, 2000.0);
+    std::uniform_real_distribution<double> amount(0.0, 60.0);
+    ProductManager productManager;
+    productManager.reserve(productCount);
+    for (std::size_t i = 0; i < productCount; ++i) {
+        int id = static_cast<int>(i) + 1;
+        productManager.addProduct(Product(id, "Product", price(rng), 10));
+        switch (i % 8) {
+            case 0: case 1: case 2:
+                productManager.setDiscount(id, Discount("percentage", amount(rng)));
+                break;
+            case 3: case 4:
+                productManager.setDiscount(id, Discount("flat", amount(rng)));
+                break;
+            case 5:
+                productManager.setDiscount(id, Discount(Discount::Rule::Percentage, amount(rng))
+                                                   .then(Discount::Rule::MinimumPrice, 1.0));
+                break;
+            default:
+                break; // No discount
+        }
+    }
+    std::cout << productCount << " products, repricing kernel: " << repricingKernelName() << "\n";
+
+    PriceTable table = productManager.repriceAll();
+    if (table.size() != productCount) {
+        std::cerr << "Price table has " << table.size() << " entries, expected " << productCount << "\n";
+        return 1;
+    }
+    for (std::size_t i = 0; i < table.size(); ++i) {
+        int id = table.getProductIds()[i];
+        if (table.getPrices()[i] != productManager.getDiscountPrice(id)) {
+            std::cerr << "Price mismatch for product " << id << "\n";
+            return 1;
+        }
+    }
+
+    const std::size_t operations = productCount * rounds;
+    {
+        BenchmarkTimer timer;
+        double total = 0.0;
+        for (std::size_t round = 0; round < rounds; ++round) {
+            for (std::size_t i = 0; i < productCount; ++i) {
+                total += productManager.getDiscountPrice(static_cast<int>(i) + 1);
+            }
+        }
+        benchmarkKeep(total);
+        benchmarkReport("getDiscountPrice per ID", operations, timer.elapsedSeconds());
+    }
+    {
+        BenchmarkTimer timer;
+        double total = 0.0;
+        for (std::size_t round = 0; round < rounds; ++round) {
+            total += productManager.repriceAll().getPrices().back();
+        }
+        benchmarkKeep(total);
+        benchmarkReport("repriceAll (gather + kernel)", operations, timer.elapsedSeconds());
+    }
+    {
+        BenchmarkTimer timer;
+        double total = 0.0;
+        for (std::size_t round = 0; round < rounds; ++round) {
+            for (std::size_t i = 0; i < productCount; ++i) {
+                total += *table.find(static_cast<int>(i) + 1);
+            }
+        }
+        benchmarkKeep(total);
+        benchmarkReport("PriceTable::find per ID", operations, timer.elapsedSeconds());
+    }
+
+    // Kernels alone, on arrays already laid out contiguously
+    std::vector<double> prices(productCount), multipliers(productCount), subtrahends(productCount);
+    std::vector<double> floors(productCount), out(productCount);
+    for (std::size_t i = 0; i < productCount; ++i) {
+        prices[i] = price(rng);
+        multipliers[i] = i % 2 == 0 ? 1.0 - amount(rng) / 100 : 1.0;
+        subtrahends[i] = i % 2 == 0 ? 0.0 : amount(rng);
+        floors[i] = i % 7 == 0 ? -std::numeric_limits<double>::infinity() : 0.0;
+    }
+    auto runKernel = [&](const std::string& name, auto kernel) {
+        BenchmarkTimer timer;
+        for (std::size_t round = 0; round < rounds; ++round) {
+            kernel(prices.data(), multipliers.data(), subtrahends.data(), floors.data(), out.data(), productCount);
+            benchmarkKeep(out[round % productCount]);
+        }
+        benchmarkReport(name, operations, timer.elapsedSeconds());
+    };
+    runKernel("scalar kernel", repriceLinearScalar);
+    std::vector<double> scalarOut = out;
+    runKernel(std::string("dispatched kernel (") + repricingKernelName() + ")", repriceLinear);
+    if (out != scalarOut) {
+        std::cerr << "Kernel results differ\n";
+        return 1;
+    }
+    return 0;
+}
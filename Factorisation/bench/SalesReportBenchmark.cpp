@@ -0,0 +1,60 @@
+// SalesReportBenchmark.cpp
+// Time to produce the sales report from running aggregates versus walking and formatting
+// every purchase of every customer, as the report used to.
+// Usage: SalesReportBenchmark [customers] [purchases]
+#include "Benchmark.h"
+#include "../CustomerManager.h"
+#include "../SalesReport.h"
+#include <random>
+#include <sstream>
+
+namespace {
+
+// Previous report body: one line per purchase
+std::string legacySalesReport(const CustomerManager& customerManager) {
+    std::ostringstream oss;
+    oss << "Sales Report:\n";
+    for (const auto& customerPair : customerManager.getAllCustomers()) {
+        oss << "Customer: " << customerPair.second->getName() << " (ID: " << customerPair.first << ")\n";
+        PurchaseHistory::View purchases = customerManager.getPurchaseHistory(customerPair.first);
+        for (const auto& purchase : purchases) {
+            oss << "  - Bought " << purchase.quantity << " " << purchase.product_name
+                << " for $" << purchase.total_cost << "\n";
+        }
+    }
+    return oss.str();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t customers = benchmarkArgument(argc, argv, 1, 10000);
+    const std::size_t purchases = benchmarkArgument(argc, argv, 2, 2000000);
+
+    CustomerManager customerManager;
+    for (std::size_t id = 1; id <= customers; ++id) {
+        customerManager.addCustomer(new Customer(static_cast<int>(id), "Customer " + std::to_string(id), "customer@example.com"));
+    }
+    std::mt19937 rng(11);
+    std::uniform_int_distribution<int> customer(1, static_cast<int>(customers));
+    std::uniform_int_distribution<int> product(1, 5000);
+    for (std::size_t i = 0; i < purchases; ++i) {
+        customerManager.addPurchase(customer(rng), "Product " + std::to_string(product(rng)), 2, 19.98);
+    }
+
+    std::cout << customers << " customers, " << purchases << " purchases\n";
+    {
+        BenchmarkTimer timer;
+        std::string report = legacySalesReport(customerManager);
+        benchmarkKeep(report.size());
+        benchmarkReport("per-purchase report (previous)", 1, timer.elapsedSeconds());
+    }
+    {
+        SalesReport salesReport(customerManager, 10);
+        BenchmarkTimer timer;
+        std::string report = salesReport.generate();
+        benchmarkKeep(report.size());
+        benchmarkReport("aggregate SalesReport", 1, timer.elapsedSeconds());
+    }
+    return 0;
+}
@@ -0,0 +1,99 @@
+// SnapshotBenchmark.cpp
+// Cold-start cost of rebuilding the store: CSV import of categories, products, customers and
+// discounts versus loading a binary StoreSnapshot of the same store plus its purchase
+// histories. Also reports the snapshot write time. The loaded store is checked against the
+// original: every discounted price, every stock level and every customer's purchase totals.
+// Usage: SnapshotBenchmark [products] [directory]
+#include "Benchmark.h"
+#include "../CsvImporter.h"
+#include "../StoreSnapshot.h"
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+int main(int argc, char** argv) {
+    const std::size_t productCount = benchmarkArgument(argc, argv, 1, 1000000);
+    const std::string directory = argc > 2 ? argv[2] : "/tmp";
+    const std::size_t categoryCount = 1000;
+    const std::size_t customerCount = productCount / 10;
+    const std::size_t purchaseCount = productCount / 2;
+
+    const std::string categoriesPath = directory + "/snapshot_bench_categories.csv";
+    const std::string productsPath = directory + "/snapshot_bench_products.csv";
+    const std::string customersPath = directory + "/snapshot_bench_customers.csv";
+    const std::string discountsPath = directory + "/snapshot_bench_discounts.csv";
+    const std::string snapshotPath = directory + "/snapshot_bench.snap";
+    {
+        std::ofstream categories(categoriesPath), products(productsPath), customers(customersPath), discounts(discountsPath);
+        for (std::size_t c = 0; c < categoryCount; ++c) {
+            categories << c << ",Category " << c << "\n";
+        }
+        for (std::size_t i = 1; i <= productCount; ++i) {
+            products << i << ",Product number " << i << "," << (i % 1000) << ".25," << (100 + i % 500) << "," << i % categoryCount << "\n";
+            if (i % 4 == 0) {
+                discounts << i << (i % 8 == 0 ? ",flat,5" : ",percentage,10,minimum_price,1") << "\n";
+            }
+        }
+        for (std::size_t i = 1; i <= customerCount; ++i) {
+            customers << i << ",Customer number " << i << ",customer" << i << "@example.com\n";
+        }
+    }
+    std::cout << productCount << " products, " << customerCount << " customers, " << purchaseCount << " purchases\n";
+
+    ThreadPool pool;
+    ProductManager original;
+    CustomerManager originalCustomers;
+    {
+        CsvImporter importer(original, originalCustomers, &pool);
+        BenchmarkTimer timer;
+        std::size_t records = importer.importCategories(categoriesPath);
+        records += importer.importProducts(productsPath);
+        records += importer.importCustomers(customersPath);
+        records += importer.importDiscounts(discountsPath);
+        benchmarkReport("CSV import (no purchase histories)", records, timer.elapsedSeconds());
+    }
+    for (std::size_t i = 0; i < purchaseCount; ++i) {
+        int product_id = static_cast<int>((i * 7919) % productCount) + 1;
+        const Product* product = original.findProduct(product_id);
+        originalCustomers.addPurchase(static_cast<int>(i % customerCount) + 1, product_id, product->getName(), 1, original.getDiscountPrice(product_id));
+    }
+
+    const std::size_t records = categoryCount + productCount + productCount / 4 + customerCount + purchaseCount;
+    {
+        BenchmarkTimer timer;
+        StoreSnapshot::write(snapshotPath, original, originalCustomers);
+        benchmarkReport("snapshot write", records, timer.elapsedSeconds());
+    }
+    ProductManager loaded;
+    CustomerManager loadedCustomers;
+    {
+        BenchmarkTimer timer;
+        StoreSnapshot::load(snapshotPath, loaded, loadedCustomers);
+        benchmarkReport("snapshot load (with purchase histories)", records, timer.elapsedSeconds());
+    }
+
+    for (const Product* product : original.getAllProducts()) {
+        const Product* copy = loaded.findProduct(product->getProductId());
+        if (copy == nullptr || copy->getName() != product->getName() || copy->getQuantity() != product->getQuantity() ||
+            loaded.getDiscountPrice(product->getProductId()) != original.getDiscountPrice(product->getProductId()) ||
+            copy->getCategory()->getCategoryId() != product->getCategory()->getCategoryId()) {
+            std::cerr << "Loaded product " << product->getProductId() << " differs\n";
+            return 1;
+        }
+    }
+    for (const auto& [customer_id, customer] : originalCustomers.getAllCustomers()) {
+        PurchaseHistory::Totals expected = originalCustomers.getPurchaseTotals(customer_id);
+        PurchaseHistory::Totals actual = loadedCustomers.getPurchaseTotals(customer_id);
+        const Customer* copy = loadedCustomers.findCustomer(customer_id);
+        if (copy == nullptr || copy->getEmail() != customer->getEmail() || actual.purchases != expected.purchases ||
+            actual.units != expected.units || actual.revenue != expected.revenue) {
+            std::cerr << "Loaded customer " << customer_id << " differs\n";
+            return 1;
+        }
+    }
+
+    for (const std::string& path : {categoriesPath, productsPath, customersPath, discountsPath, snapshotPath}) {
+        std::remove(path.c_str());
+    }
+    return 0;
+}
@@ -0,0 +1,86 @@
+// StaticFactorizationBenchmark.cpp
+// Small-number factorization through the compile-time StaticSieve fast path (statically
+// dispatched, no allocation) versus the same table behind the virtual FactoringMethod
+// adapter, and the runtime-built SieveFactoring. Compile-time factorization is checked with
+// static_assert; runtime results are checked against SieveFactoring.
+// Usage: StaticFactorizationBenchmark [numbers]
+#include "Benchmark.h"
+#include "../SieveFactoring.h"
+#include "../StaticSieve.h"
+#include <random>
+#include <vector>
+
+namespace {
+
+constexpr std::uint32_t kBound = 1u << 16;
+using Sieve = StaticSieve<kBound>;
+
+// Fully factored by the compiler
+static_assert(kFactorsOf<360>.size() == 6 && kFactorsOf<360>[0] == 2 && kFactorsOf<360>[5] == 5);
+static_assert(kFactorsOf<4294967291ull * 4294967279ull>[0] == 4294967279ull);
+static_assert(Sieve::factorize(65535).size() == 4 && Sieve::factorize(65535)[3] == 257);
+static_assert(Sieve::isPrime(65521) && !Sieve::isPrime(65535));
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t count = benchmarkArgument(argc, argv, 1, 10000000);
+
+    std::mt19937 rng(29);
+    std::uniform_int_distribution<std::uint32_t> pick(2, kBound);
+    std::vector<std::uint32_t> numbers(count);
+    for (std::uint32_t& n : numbers) {
+        n = pick(rng);
+    }
+
+    SieveFactoring runtimeSieve(kBound);
+    for (std::size_t i = 0; i < std::min<std::size_t>(count, 100000); ++i) {
+        StaticFactors fast = Sieve::factorize(numbers[i]);
+        std::vector<std::uint64_t> expected = runtimeSieve.factorize(numbers[i]);
+        if (!std::equal(fast.begin(), fast.end(), expected.begin(), expected.end())) {
+            std::cerr << "StaticSieve disagrees on " << numbers[i] << "\n";
+            return 1;
+        }
+    }
+
+    {
+        BenchmarkTimer timer;
+        std::uint64_t total = 0;
+        for (std::uint32_t n : numbers) {
+            Sieve::forEachFactor(n, [&total](std::uint32_t prime) { total += prime; });
+        }
+        benchmarkKeep(total);
+        benchmarkReport("StaticSieve::forEachFactor (static)", count, timer.elapsedSeconds());
+    }
+    {
+        BenchmarkTimer timer;
+        std::uint64_t total = 0;
+        for (std::uint32_t n : numbers) {
+            total += Sieve::factorize(n).size();
+        }
+        benchmarkKeep(total);
+        benchmarkReport("StaticSieve::factorize by value (static)", count, timer.elapsedSeconds());
+    }
+
+    StaticSieveFactoring<kBound> adapter;
+    const FactoringMethod* methods[] = {&adapter, &runtimeSieve};
+    const char* names[] = {"StaticSieveFactoring (virtual)", "SieveFactoring (virtual)"};
+    for (std::size_t m = 0; m < 2; ++m) {
+        BenchmarkTimer timer;
+        std::uint64_t total = 0;
+        for (std::uint32_t n : numbers) {
+            total += methods[m]->factorize(n).size();
+        }
+        benchmarkKeep(total);
+        benchmarkReport(names[m], count, timer.elapsedSeconds());
+    }
+
+    std::vector<std::uint64_t> wide(numbers.begin(), numbers.end());
+    FactorizationBatch batch;
+    {
+        BenchmarkTimer timer;
+        adapter.factorizeBatch(wide, batch);
+        benchmarkReport("StaticSieveFactoring::factorizeBatch", count, timer.elapsedSeconds());
+    }
+    return 0;
+}
@@ -0,0 +1,118 @@
+#ifndef WORKLOAD_H
+#define WORKLOAD_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+#include "../CustomerManager.h"
+#include "../Discount.h"
+#include "../ProductManager.h"
+
+// Synthetic store data for the benchmark programs: a catalog, a customer base and purchase
+// streams in which a few products and customers account for most of the traffic.
+
+// Ranks in [0, count) where rank k is drawn with probability proportional to 1 / (k + 1)^exponent
+// (exponent 0 is uniform; around 1 matches typical product popularity)
+class ZipfDistribution {
+public:
+    ZipfDistribution(std::size_t count, double exponent) : cumulative(count) {
+        double total = 0.0;
+        for (std::size_t rank = 0; rank < count; ++rank) {
+            total += 1.0 / std::pow(static_cast<double>(rank + 1), exponent);
+            cumulative[rank] = total;
+        }
+        for (double& weight : cumulative) {
+            weight /= total;
+        }
+    }
+
+    template <typename Generator>
+    std::size_t operator()(Generator& generator) const {
+        double draw = std::uniform_real_distribution<double>(0.0, 1.0)(generator);
+        auto rank = std::lower_bound(cumulative.begin(), cumulative.end(), draw);
+        return rank == cumulative.end() ? cumulative.size() - 1 : static_cast<std::size_t>(rank - cumulative.begin());
+    }
+
+private:
+    std::vector<double> cumulative;
+};
+
+// IDs 1..count drawn by Zipf popularity; which ID gets which rank is shuffled, so the popular
+// IDs are spread over the whole range rather than clustered at the start
+class ZipfIdSampler {
+public:
+    ZipfIdSampler(std::size_t count, double exponent, std::mt19937_64& generator)
+        : ranks(count, exponent), ids(count) {
+        std::iota(ids.begin(), ids.end(), 1);
+        std::shuffle(ids.begin(), ids.end(), generator);
+    }
+
+    int operator()(std::mt19937_64& generator) const {
+        return ids[ranks(generator)];
+    }
+
+private:
+    ZipfDistribution ranks;
+    std::vector<int> ids;
+};
+
+// Products 1..productCount spread round-robin over categories 1..categoryCount, with prices
+// between $1 and $500 and stock units each; every fourth product gets a discount
+inline void populateProducts(ProductManager& productManager, std::size_t productCount, std::size_t categoryCount,
+                             int stock, std::mt19937_64& generator) {
+    std::vector<Category*> categories;
+    categories.reserve(categoryCount);
+    for (std::size_t id = 1; id <= categoryCount; ++id) {
+        categories.push_back(productManager.createCategory(static_cast<int>(id), "Category " + std::to_string(id)));
+    }
+
+    std::uniform_real_distribution<double> price(1.0, 500.0);
+    productManager.reserve(productCount);
+    for (std::size_t id = 1; id <= productCount; ++id) {
+        productManager.emplaceProduct(static_cast<int>(id), "Product " + std::to_string(id),
+                                      std::round(price(generator) * 100.0) / 100.0, stock,
+                                      categories.empty() ? nullptr : categories[(id - 1) % categories.size()]);
+        switch (id % 8) {
+        case 0: productManager.setDiscount(static_cast<int>(id), Discount("percentage", 15.0)); break;
+        case 4: productManager.setDiscount(static_cast<int>(id), Discount("flat", 5.0)); break;
+        default: break;
+        }
+    }
+}
+
+// Customers 1..customerCount
+inline void populateCustomers(CustomerManager& customerManager, std::size_t customerCount) {
+    for (std::size_t id = 1; id <= customerCount; ++id) {
+        customerManager.emplaceCustomer(static_cast<int>(id), "Customer " + std::to_string(id),
+                                        "customer" + std::to_string(id) + "@example.com");
+    }
+}
+
+// One purchase of a synthetic stream
+struct PurchaseEvent {
+    int customer_id;
+    int product_id;
+    int quantity;
+};
+
+// count purchases with Zipf-distributed customers and products and 1 to 5 units each
+inline std::vector<PurchaseEvent> zipfPurchaseStream(std::size_t count, std::size_t customerCount, std::size_t productCount,
+                                                     double exponent, std::mt19937_64& generator) {
+    ZipfIdSampler customers(customerCount, exponent, generator);
+    ZipfIdSampler products(productCount, exponent, generator);
+    std::uniform_int_distribution<int> quantity(1, 5);
+    std::vector<PurchaseEvent> stream;
+    stream.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        int customer = customers(generator);
+        int product = products(generator);
+        stream.push_back({customer, product, quantity(generator)});
+    }
+    return stream;
+}
+
+#endif // WORKLOAD_H
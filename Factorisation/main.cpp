@@ -7,23 +7,41 @@
 #include "PurchaseHistoryFormatter.h"
 #include "PlainTextPurchaseHistoryFormatter.h"
 #include "ReceiptFormat.h"
+#include "ReceiptSink.h"
+#include "AsyncReceiptSink.h"
 #include "ReportGenerator.h"
 #include "SalesReport.h"
 #include "InventoryReport.h"
+#include "TransactionJournal.h"
+#include <memory>
+#include <string_view>
+
+// Usage: main [--journal path]
+// With a journal, purchases from earlier runs are replayed at startup and new ones are recorded.
+int main(int argc, char** argv) {
+    if (argc != 1 && (argc != 3 || std::string_view(argv[1]) != "--journal")) {
+        std::cerr << "Usage: " << argv[0] << " [--journal path]\n";
+        return 2;
+    }
 
-int main() {
     try {
         // Initialize managers
         ProductManager productManager;
         CustomerManager customerManager;
+        std::unique_ptr<TransactionJournal> journal;
+        if (argc == 3) {
+            journal = std::make_unique<TransactionJournal>(argv[2]);
+        }
 
         // Initialize UI components
         TextReceiptFormat textReceipt;
         InventoryUI inventoryUI;
         PlainTextPurchaseHistoryFormatter purchaseHistoryFormatter;
 
-        // Initialize transaction processing
-        Transaction transaction(productManager, customerManager, textReceipt);
+        // Initialize transaction processing; receipts are printed by a background writer
+        ConsoleReceiptSink consoleSink;
+        AsyncReceiptSink receiptSink(consoleSink);
+        Transaction transaction(productManager, customerManager, textReceipt, receiptSink);
 
         // Initialize reporting
         SalesReport salesReport(customerManager);
@@ -32,7 +50,7 @@ int main() {
 
         // Create and run the program
         Program program(productManager, customerManager, transaction, inventoryUI,
-                        purchaseHistoryFormatter, reportGenerator);
+                        purchaseHistoryFormatter, reportGenerator, journal.get());
         program.run();
 
     } catch (const std::exception& e) {
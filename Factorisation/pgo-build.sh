@@ -0,0 +1,18 @@
+#!/bin/sh
+# Two-stage profile-guided optimization build of the demo and the benchmarks.
+# Usage: ./pgo-build.sh [build directory] [extra CMake arguments...]
+# Stage 1 builds instrumented binaries and runs the pgo-train workload; stage 2 rebuilds the
+# same directory (object paths must match the profile) with the collected profile.
+set -e
+
+source_dir=$(cd "$(dirname "$0")" && pwd)
+build_dir=${1:-"$source_dir/build-pgo"}
+[ $# -gt 0 ] && shift
+
+rm -rf "$build_dir/pgo-profile"
+cmake -S "$source_dir" -B "$build_dir" -DCMAKE_BUILD_TYPE=Release -DFACTORISATION_PGO=GENERATE "$@"
+cmake --build "$build_dir" --target pgo-train -j
+
+cmake -S "$source_dir" -B "$build_dir" -DFACTORISATION_PGO=USE "$@"
+cmake --build "$build_dir" --clean-first -j
+echo "Profile-optimized binaries are in $build_dir"